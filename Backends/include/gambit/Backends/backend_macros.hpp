@@ -107,6 +107,20 @@ END_BE_NAMESPACE                                                            \
 CORE_ALLOWED_MODEL(BackendIniBit,CAT_4(BACKENDNAME,_,SAFE_VERSION,_init),   \
  MODEL, NOT_MODEL)                                                          \
 
+/// Declare that the functions of this backend must not be called from more than one thread at a time.
+#define BE_NOT_REENTRANT                                                    \
+namespace Gambit                                                            \
+{                                                                           \
+  namespace Backends                                                        \
+  {                                                                         \
+    namespace CAT_3(BACKENDNAME,_,SAFE_VERSION)                             \
+    {                                                                       \
+      int not_reentrant = set_backend_not_reentrant(STRINGIFY(BACKENDNAME), \
+       STRINGIFY(VERSION));                                                 \
+    }                                                                       \
+  }                                                                         \
+}                                                                           \
+
 /// Set all the allowed models for a given backend functor.
 #define SET_ALLOWED_MODELS(NAME, MODELS)                                    \
 int CAT(allowed_models_set_,NAME) =                                         \
@@ -44,6 +44,9 @@
 #define BE_ALLOW_MODEL(MODEL) MODULE_ALLOWED_MODEL(BackendIniBit,           \
  CAT_4(BACKENDNAME,_,SAFE_VERSION,_init), MODEL, NOT_MODEL)                 \
 
+/// Non-reentrant backends only need to be declared in the backend compile unit.
+#define BE_NOT_REENTRANT
+
 /// Make the inUse pipe for a given backend functor.
 #define MAKE_INUSE_POINTER(NAME)                                            \
   namespace BackendIniBit                                                   \
@@ -23,6 +23,9 @@
 
 LOAD_LIBRARY
 
+// CalcHEP keeps the model and generated processes in global state
+BE_NOT_REENTRANT
+
 BE_ALLOW_MODELS(ScalarSingletDM_Z2)
 BE_ALLOW_MODELS(DMEFT)
 
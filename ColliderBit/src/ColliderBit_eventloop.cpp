@@ -32,10 +32,14 @@
 ///  \date   2018 Jan
 ///  \date   2018 May
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
 #include "gambit/Elements/gambit_module_headers.hpp"
 #include "gambit/ColliderBit/ColliderBit_eventloop.hpp"
+#include "gambit/Utils/fidelity.hpp"
 
 // #define COLLIDERBIT_DEBUG
 #define DEBUG_PREFIX "DEBUG: OMP thread " << omp_get_thread_num() << ":  " << __FILE__ << ":" << __LINE__ << ":  "
@@ -60,9 +64,13 @@ namespace Gambit
       // Retrieve run options from the YAML file (or standalone code)
       static bool first = true;
       static bool silenceLoop;
-      static std::map<str,int> min_nEvents;
-      static std::map<str,int> max_nEvents;
-      static std::map<str,int> stoppingres;
+      // The event counts and convergence target can differ between fidelity levels (via the fidelity option), so they
+      // are kept for each level.
+      static std::map<int, std::map<str,int>> min_nEvents_at_level;
+      static std::map<int, std::map<str,int>> max_nEvents_at_level;
+      static std::map<int, std::map<str,int>> stoppingres_at_level;
+      static std::map<int, std::map<str,double>> target_stat_at_level;
+      const int fidelity = Utils::fidelity_level();
       if (first)
       {
         // Should we silence stdout during the loop?
@@ -81,21 +89,13 @@ namespace Gambit
         for (auto& collider : result.collider_names)
         {
           Options colOptions(runOptions->getValue<YAML::Node>(collider));
-          min_nEvents[collider]                                           = colOptions.getValue<int>("min_nEvents");
-          max_nEvents[collider]                                           = colOptions.getValue<int>("max_nEvents");
-          result.convergence_options[collider].target_stat                = colOptions.getValue<double>("target_fractional_uncert");
           result.convergence_options[collider].stop_at_sys                = colOptions.getValueOrDef<bool>(true, "halt_when_systematic_dominated");
           result.convergence_options[collider].all_analyses_must_converge = colOptions.getValueOrDef<bool>(false, "all_analyses_must_converge");
           result.convergence_options[collider].all_SR_must_converge       = colOptions.getValueOrDef<bool>(false, "all_SR_must_converge");
           result.maxFailedEvents[collider]                                = colOptions.getValueOrDef<int>(1, "maxFailedEvents");
           result.invalidate_failed_points[collider]                       = colOptions.getValueOrDef<bool>(false, "invalidate_failed_points");
-          stoppingres[collider]                                           = colOptions.getValueOrDef<int>(200, "events_between_convergence_checks");
           result.analyses[collider]                                       = colOptions.getValueOrDef<std::vector<str>>(std::vector<str>(), "analyses");
           result.event_count[collider]                                    = 0;
-          // Check that the nEvents options given make sense.
-          if (min_nEvents.at(collider) > max_nEvents.at(collider))
-           ColliderBit_error().raise(LOCAL_INFO,"Option min_nEvents is greater than corresponding max_nEvents for collider "
-                                                +collider+". Please correct your YAML file.");
           // Check that the analyses all correspond to actual ColliderBit analyses, and sort them into separate maps for each detector.
           for (str& analysis : result.analyses.at(collider))
           {
@@ -105,6 +105,30 @@ namespace Gambit
         first = false;
       }
 
+      // Retrieve the event counts and convergence target for each collider at this fidelity level.
+      if (min_nEvents_at_level.count(fidelity) == 0)
+      {
+        for (auto& collider : result.collider_names)
+        {
+          Options colOptions(runOptions->getValue<YAML::Node>(collider));
+          min_nEvents_at_level[fidelity][collider] = colOptions.getValue<int>("min_nEvents");
+          max_nEvents_at_level[fidelity][collider] = colOptions.getValue<int>("max_nEvents");
+          target_stat_at_level[fidelity][collider] = colOptions.getValue<double>("target_fractional_uncert");
+          stoppingres_at_level[fidelity][collider] = colOptions.getValueOrDef<int>(200, "events_between_convergence_checks");
+          // Check that the nEvents options given make sense.
+          if (min_nEvents_at_level[fidelity].at(collider) > max_nEvents_at_level[fidelity].at(collider))
+           ColliderBit_error().raise(LOCAL_INFO,"Option min_nEvents is greater than corresponding max_nEvents for collider "
+                                                +collider+". Please correct your YAML file.");
+        }
+      }
+      const std::map<str,int>& min_nEvents = min_nEvents_at_level.at(fidelity);
+      const std::map<str,int>& max_nEvents = max_nEvents_at_level.at(fidelity);
+      const std::map<str,int>& stoppingres = stoppingres_at_level.at(fidelity);
+      for (auto& collider : result.collider_names)
+      {
+        result.convergence_options[collider].target_stat = target_stat_at_level.at(fidelity).at(collider);
+      }
+
       // Do the base-level initialisation
       Loop::executeIteration(BASE_INIT);
 
@@ -36,7 +36,9 @@
 #include <list>
 #include <vector>
 #include <map>
+#include <set>
 #include <queue>
+#include <memory>
 
 #include "gambit/Core/core.hpp"
 #include "gambit/Core/error_handlers.hpp"
@@ -44,6 +46,7 @@
 #include "gambit/Printers/baseprinter.hpp"
 #include "gambit/Elements/functors.hpp"
 #include "gambit/Elements/type_equivalency.hpp"
+#include "gambit/Utils/mpiwrapper.hpp"
 
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/topological_sort.hpp>
@@ -70,6 +73,23 @@ namespace Gambit
     typedef std::map<std::string, std::vector<functor*> > outputMapType;
     /// @}
 
+    /// Parameter values of a primary model at the previous point, and the memoised functors that depend on them
+    struct MemoisedModelInfo
+    {
+      primary_model_functor* model;
+      std::vector<double> last_values;
+      std::vector<size_t> dependents;
+    };
+
+    /// A functor whose results are kept in the persistent result cache, with the part of its cache key that is
+    /// the same at every point, and the primary models whose parameters make up the rest
+    struct CachedFunctorInfo
+    {
+      module_functor_common* functor;
+      str key_prefix;
+      std::vector<primary_model_functor*> models;
+    };
+
     /// Minimal info about outputVertices
     struct OutputVertexInfo
     {
@@ -148,6 +168,9 @@ namespace Gambit
         /// Calculate a single target vertex.
         void calcObsLike(VertexID);
 
+        /// Getter for parallel_evaluation flag
+        bool parallelEvaluation();
+
         /// Print a single target vertex.
         void printObsLike(VertexID, const int);
 
@@ -157,12 +180,15 @@ namespace Gambit
         /// Get the functor corresponding to a single VertexID
         functor* get_functor(VertexID);
 
+        /// Get the summed average runtime of all active functors that depend on a given functor
+        double getDownstreamRuntime(const functor*);
+
         /// Ensure that the type of a given vertex is equivalent to at least one of a provided list, and return the matching list entry.
         str checkTypeMatch(VertexID, const str&, const std::vector<str>&);
 
         /// Return the result of a functor.
         template <typename TYPE>
-        TYPE getObsLike(VertexID vertex)
+        const TYPE& getObsLike(VertexID vertex)
         {
           module_functor<TYPE>* module_ptr = dynamic_cast<module_functor<TYPE>*>(masterGraph[vertex]);
           if (module_ptr == NULL)
@@ -183,10 +209,54 @@ namespace Gambit
 
         void resetAll();
 
+        /// Reset memoised functors whose model parameter inputs have changed since the previous point
+        void refreshMemoisedFunctors();
+
+        /// Set the keys of the results for the current point in the persistent result cache
+        void updateResultCacheKeys();
+
+        /// Number of fidelity levels at which points can be computed
+        int fidelityLevels();
+
+        /// Switch to computing the current point at the given fidelity level, and reset the functors whose results
+        /// depend on it
+        void setFidelity(int);
+
+        /// Report statistics gathered during the scan
+        void finalise();
+
+        /// Count a point, and every runtime_statistics_sync_interval points start averaging the runtime statistics
+        /// over all processes.  Returns true if an average arrived (and so the ObsLike order may have changed).
+        bool syncRuntimeStatistics();
+
       private:
         /// Adds list of functor pointers to master graph
         void addFunctors();
 
+        /// Flatten the resolved graph into the per-point execution, print and reset lists
+        void compileExecutionPlan();
+
+        /// Work out which functors can keep their results between points, and which model parameters they depend on
+        void setupMemoisation();
+
+        /// Open the persistent result cache, and work out what the results of the functors using it depend on
+        void setupResultCache();
+
+        /// Give functors their options at each fidelity level, and work out which functors depend on the level
+        void setupFidelity();
+
+        /// Seed the runtime statistics of active functors from those saved by a previous run
+        void loadRuntimeStatistics();
+
+        /// Fill runtime_stats_local with this process' weighted runtime statistics
+        void collectRuntimeStatistics();
+
+        /// Set the runtime statistics of functors from sums of weighted statistics.  Returns true if any were set.
+        bool applyRuntimeStatistics(const std::vector<double>&);
+
+        /// Average the runtime statistics over all processes one last time, and save them
+        void finaliseRuntimeStatistics();
+
         /// Pretty print backend functor information
         str printGenericFunctorList(const std::vector<functor*>&);
         str printGenericFunctorList(const std::vector<VertexID>&);
@@ -247,6 +317,15 @@ namespace Gambit
         /// scanned over.
         std::vector<DRes::VertexID> closestCandidateForModel(std::vector<DRes::VertexID> candidates);
 
+        /// Sort the vertices required by each ObsLike into levels of mutually independent functors.
+        void setupParallelEvaluation();
+
+        /// Calculate a single target vertex, running independent functors concurrently.
+        void calcObsLikeParallel(VertexID);
+
+        /// Log the critical path length and total work of the functors evaluated for the current point.
+        void reportCriticalPath();
+
         //
         // Private data members
         //
@@ -278,6 +357,15 @@ namespace Gambit
         /// Saved calling order for functions required to compute single ObsLike entries
         std::map<VertexID, std::vector<VertexID>> SortedParentVertices;
 
+        /// Functors to call, in order, to compute single ObsLike entries
+        std::map<VertexID, std::vector<functor*>> ExecutionPlan;
+
+        /// Functors with printable (non-void) results required by single ObsLike entries
+        std::map<VertexID, std::vector<functor*>> PrintPlan;
+
+        /// All active functors, to be reset after each point
+        std::vector<functor*> activeFunctors;
+
         /// Temporary map for loop manager -> list of nested functions
         std::map<VertexID, std::set<VertexID>> loopManagerMap;
 
@@ -302,6 +390,104 @@ namespace Gambit
 
         /// Global flag for triggering printing of unitCubeParameters
         bool print_unitcube = false;
+
+        /// Global flag for logging the average runtime of each functor after it is called
+        bool log_runtime = false;
+
+        /// Global flag for evaluating independent functors concurrently
+        bool parallel_evaluation = false;
+
+        /// Global flag for logging the critical path vs total work of each point in parallel mode
+        bool report_critical_path = false;
+
+        /// Backends used by each vertex (to fulfil backend requirements or class loading)
+        std::map<VertexID, std::set<str>> vertexBackends;
+
+        /// Backends used by each vertex, with their versions
+        std::map<VertexID, std::set<str>> vertexBackendVersions;
+
+        /// Levels of mutually independent vertices required to compute single ObsLike entries
+        std::map<VertexID, std::vector<std::vector<VertexID>>> ParallelLevels;
+
+        /// Vertices that may run concurrently with others, but never with each other
+        std::set<VertexID> serialVertices;
+
+        /// Vertices that must not be run inside an OpenMP parallel region (loop managers and their nested functors)
+        std::set<VertexID> outOfRegionVertices;
+
+        /// Wall time spent in each vertex evaluated for the current point (parallel mode only)
+        std::map<VertexID, double> pointVertexRuntimes;
+
+        /// Global flag for keeping the results of functors whose model parameter inputs have not changed
+        bool memoise_functors = false;
+
+        /// Functors that keep their results between points until their model parameter inputs change
+        std::vector<functor*> memoisedFunctors;
+
+        /// Number of points at which each memoised functor kept its previous result (same order as memoisedFunctors)
+        std::vector<long long> memoisedReuses;
+
+        /// Number of points seen by refreshMemoisedFunctors
+        long long memoisedPoints = 0;
+
+        /// Primary models that memoised functors depend on
+        std::vector<MemoisedModelInfo> memoisedModels;
+
+        /// Persistent cache of functor results, shared between processes and runs (NULL if not used)
+        std::unique_ptr<Utils::result_cache> resultCache;
+
+        /// Functors whose results are kept in the persistent result cache
+        std::vector<CachedFunctorInfo> cachedFunctors;
+
+        /// Number of fidelity levels at which points can be computed (1 unless multi-fidelity evaluation is in use)
+        int fidelity_levels = 1;
+
+        /// Functors with options for each fidelity level
+        std::vector<functor*> fidelityFunctors;
+
+        /// Functors that must be recomputed when the fidelity level changes (fidelityFunctors, loop managers running any
+        /// of them, and everything downstream)
+        std::vector<functor*> fidelityDependents;
+
+        /// Global flag for saving functor runtime statistics, and sharing them between processes and runs
+        bool persist_runtime_stats = false;
+
+        /// Number of points between averages of the runtime statistics over processes
+        long long runtime_stats_interval = 1000;
+
+        /// Number of points evaluated by this process
+        long long runtime_stats_points = 0;
+
+        /// Directory holding the saved runtime statistics
+        str runtime_stats_path;
+
+        /// Functors whose runtime statistics are shared and saved (the active and memoised ones), sorted by name so
+        /// that all processes list them in the same order
+        std::vector<functor*> runtimeStatsFunctors;
+
+        /// This process' (weighted runtime, weighted invalidation rate, weight) for each of runtimeStatsFunctors, and
+        /// their sums over all processes
+        std::vector<double> runtime_stats_local;
+        std::vector<double> runtime_stats_sums;
+
+        #ifdef WITH_MPI
+          /// Communicator used only for reducing the runtime statistics
+          GMPI::Comm runtimeStatsComm;
+
+          /// Request of the reduction in progress, if any
+          MPI_Request runtime_stats_request;
+          bool runtime_stats_pending = false;
+
+          /// Number of reductions started by this process
+          int runtime_stats_reductions = 0;
+
+          /// Seconds to wait for the other processes when finalising the runtime statistics
+          double runtime_stats_timeout = 60;
+
+          /// Wait for a reduction of the runtime statistics to complete.  Returns false if a shutdown has begun or the
+          /// other processes have not joined the reduction within runtime_stats_timeout.
+          bool waitForRuntimeStatistics(MPI_Request*);
+        #endif
   };
   }
 }
@@ -84,8 +84,24 @@ namespace Gambit
       str lnlike_modifier_name;
       Options lnlike_modifier_params;
 
-      /// Map of return types of target functors
-      std::map<DRes::VertexID,str> return_types;
+      /// Return types that target functors may have
+      enum class lnlike_type { dbl, vec_dbl, flt, vec_flt };
+
+      /// Return types of target functors (same order as target_vertices)
+      std::vector<lnlike_type> return_types;
+
+      /// Upper bounds on the contributions of target functors to the total log-likelihood (same order as target_vertices)
+      std::vector<double> upper_bounds;
+
+      /// Upper bound on the summed contributions of all target functors after each one (same order as target_vertices)
+      std::vector<double> remaining_upper_bounds;
+
+      /// Descriptions of target and auxiliary functors, for log and debug output (same order as the vertices)
+      std::vector<str> target_tags;
+      std::vector<str> aux_tags;
+
+      /// Print timing data for each point?
+      bool print_timing;
 
       /// Global record of time that last likelihood evaluation began, for computing true total iteration time.
       std::chrono::time_point<std::chrono::system_clock> previous_startL;
@@ -105,9 +121,56 @@ namespace Gambit
       /// Invalid Code printing ID
       const int invalidcodeID;
 
+      /// Number of fidelity levels at which points can be computed
+      int fidelity_levels;
+
+      /// How the fidelity level of each point is chosen: 'scanner' (as requested by the scanner, full accuracy by
+      /// default) or 'promote' (recompute at the next level while the total may reach the scanner's threshold)
+      str fidelity_policy;
+
+      /// Margin below the threshold within which points are promoted, and by which the threshold is lowered below
+      /// full fidelity when deciding whether to skip the remaining likelihoods
+      double fidelity_margin;
+
+      /// Distance below the best total log-likelihood so far at which to put the threshold, if the scanner sets none
+      double fidelity_delta_lnlike;
+
+      /// Best total log-likelihood computed at full fidelity by this process
+      double best_full_fidelity_lnlike;
+
+      /// Fidelity level printing ID
+      const int fidelityID;
+
       /// Run in likelihood debug mode?
       bool debug;
 
+      /// Put the target vertices in the order given by the current runtime statistics
+      void sortTargetVertices();
+
+      /// Work out the largest log-likelihood that can still be added after each target vertex
+      void setRemainingUpperBounds();
+
+      /// Where to find each model parameter in the array passed to main_array
+      struct parameter_slot
+      {
+        ModelParameters *params; // Parameter object of the model
+        size_t index;            // Index of the parameter in params
+        size_t position;         // Position of the parameter in the array
+      };
+      std::vector<parameter_slot> parameter_slots;
+
+      /// Set the values of the parameters from an array, in the order given to setParameterOrder
+      void setParameters (const double *);
+
+      /// Make the values of the parameters available to exceptions and debug output
+      void reportParameters();
+
+      /// Get the current values of the parameters, in a YAML-ready string
+      str parameterString() const;
+
+      /// Evaluate total likelihood function at the parameters already set
+      double evaluate();
+
     public:
 
       /// Constructor
@@ -115,14 +178,26 @@ namespace Gambit
        DRes::DependencyResolver &dependencyResolver, IniParser::IniFile &iniFile,
        const str &purpose, Printers::BaseBasePrinter& printer);
 
+      /// Destructor
+      ~Likelihood_Container();
+
       /// Do the prior transformation and populate the parameter map
       void setParameters (const std::unordered_map<std::string, double> &);
 
       /// Evaluate total likelihood function
       double main (std::unordered_map<std::string, double> &in);
 
+      /// Fix the order of the parameters passed to main_array
+      bool setParameterOrder(const std::vector<std::string> &);
+
+      /// Evaluate total likelihood function, with parameters given in the order fixed by setParameterOrder
+      double main_array(const double *);
+
       /// Use this to modify the total likelihood function before passing it to the scanner
       double purposeModifier(double lnlike);
+
+      /// Estimate the cost of re-evaluating the likelihood when each parameter changes, from the runtimes of the functors depending on it
+      std::unordered_map<std::string, double> getParameterCosts();
   };
 
   // Register the Likelihood Container as an available target function for ScannerBit.  The first argument
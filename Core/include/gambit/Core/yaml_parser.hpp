@@ -33,6 +33,8 @@
 
 #include "yaml-cpp/yaml.h"
 
+#include <limits>
+
 
 namespace Gambit
 {
@@ -56,6 +58,7 @@ namespace Gambit
         std::string version;
         bool printme; // Instruction to printer as to whether to write result to disk
         bool weakrule;  // Indicates that rule can be broken
+        double lnlike_upper_bound; // Largest possible contribution of a likelihood to the total log-likelihood
         Options options;
         YAML::Node subcaps;
         std::vector<Observable> dependencies;
@@ -72,6 +75,7 @@ namespace Gambit
           backend(),
           version(),
           printme(true),
+          lnlike_upper_bound(std::numeric_limits<double>::infinity()),
           options(),
           subcaps(),
           dependencies(),
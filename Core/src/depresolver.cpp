@@ -45,12 +45,19 @@
 #include "gambit/Utils/citation_keys.hpp"
 #include "gambit/Logs/logger.hpp"
 #include "gambit/Backends/backend_singleton.hpp"
+#include "gambit/Utils/signal_handling.hpp"
+#include "gambit/Utils/fidelity.hpp"
 #include "gambit/cmake/cmake_variables.hpp"
 
+#include <array>
+#include <cstdio>
 #include <sstream>
 #include <fstream>
 #include <iomanip>
 #include <regex>
+#include <chrono>
+#include <thread>
+#include <exception>
 
 #include <boost/format.hpp>
 #include <boost/algorithm/string/replace.hpp>
@@ -414,6 +421,24 @@ namespace Gambit
         SortedParentVertices[*it] = getSortedParentVertices(*it, masterGraph, function_order);
       }
 
+      // Flatten the per-point work into plain lists of functors.
+      compileExecutionPlan();
+
+      // Start from the runtime statistics gathered by earlier runs, if any, so that the ObsLike order is good from the first point.
+      if (persist_runtime_stats) loadRuntimeStatistics();
+
+      // Separate out the functors that can keep their results from one point to the next.
+      if (memoise_functors) setupMemoisation();
+
+      // Connect functors to the persistent result cache, if any are to use it.
+      setupResultCache();
+
+      // Give functors their options at each fidelity level, if there is more than one.
+      if (fidelity_levels > 1) setupFidelity();
+
+      // Work out which of those vertices can be evaluated concurrently.
+      if (parallel_evaluation) setupParallelEvaluation();
+
       // Print list of backends required
       if (boundCore->show_backends)
       {
@@ -719,72 +744,224 @@ namespace Gambit
     // Evaluates ObsLike vertex, and everything it depends on, and prints results
     void DependencyResolver::calcObsLike(VertexID vertex)
     {
-      if (SortedParentVertices.find(vertex) == SortedParentVertices.end())
+      auto plan = ExecutionPlan.find(vertex);
+      if (plan == ExecutionPlan.end())
         core_error().raise(LOCAL_INFO, "Tried to calculate a function not in or not at top of dependency graph.");
-      std::vector<VertexID> order = SortedParentVertices.at(vertex);
 
-      for (std::vector<VertexID>::iterator it = order.begin(); it != order.end(); ++it)
+      if (parallel_evaluation)
       {
-        std::ostringstream ss;
-        ss << "Calling " << masterGraph[*it]->name() << " from " << masterGraph[*it]->origin() << "...";
-        logger() << LogTags::dependency_resolver << LogTags::info << LogTags::debug << ss.str() << EOM;
-        masterGraph[*it]->calculate();
-        if (boundIniFile->getValueOrDef<bool>(
-              false, "dependency_resolution", "log_runtime") )
+        calcObsLikeParallel(vertex);
+      }
+      else
+      {
+        for (functor* f : plan->second)
         {
-          double T = masterGraph[*it]->getRuntimeAverage();
-          logger() << LogTags::dependency_resolver << LogTags::info <<
-            "Runtime, averaged over multiple calls [s]: " << T << EOM;
+          logger() << LogTags::dependency_resolver << LogTags::info << LogTags::debug << "Calling "
+                   << f->name() << " from " << f->origin() << "..." << EOM;
+          f->calculate();
+          if (log_runtime)
+          {
+            double T = f->getRuntimeAverage();
+            logger() << LogTags::dependency_resolver << LogTags::info <<
+              "Runtime, averaged over multiple calls [s]: " << T << EOM;
+          }
+          invalid_point_exception* e = f->retrieve_invalid_point_exception();
+          if (e != NULL) throw(*e);
         }
-        invalid_point_exception* e = masterGraph[*it]->retrieve_invalid_point_exception();
-        if (e != NULL) throw(*e);
       }
       // Reset the cout output precision, in case any backends have messed with it during the ObsLike evaluation.
       cout << std::setprecision(boundCore->get_outprec());
     }
 
+    // Evaluates ObsLike vertex and everything it depends on, level by level, running
+    // the mutually independent functors within each level concurrently.
+    void DependencyResolver::calcObsLikeParallel(VertexID vertex)
+    {
+      typedef std::chrono::steady_clock clock;
+      const std::vector<std::vector<VertexID>>& levels = ParallelLevels.at(vertex);
+
+      for (auto level = levels.begin(); level != levels.end(); ++level)
+      {
+        std::vector<VertexID> concurrent;
+        for (auto it = level->begin(); it != level->end(); ++it)
+        {
+          // Loop managers and their nested functors run their own parallel regions, so run them outside ours.
+          if (outOfRegionVertices.find(*it) != outOfRegionVertices.end())
+          {
+            logger() << LogTags::dependency_resolver << LogTags::info << LogTags::debug << "Calling "
+                     << masterGraph[*it]->name() << " from " << masterGraph[*it]->origin() << "..." << EOM;
+            clock::time_point start = clock::now();
+            masterGraph[*it]->calculate();
+            pointVertexRuntimes[*it] += std::chrono::duration<double>(clock::now() - start).count();
+            invalid_point_exception* e = masterGraph[*it]->retrieve_invalid_point_exception();
+            if (e != NULL) throw(*e);
+          }
+          else concurrent.push_back(*it);
+        }
+        if (concurrent.empty()) continue;
+
+        const int n = concurrent.size();
+        std::vector<double> runtimes(n, 0.0);
+        std::exception_ptr error = nullptr;
+
+        // Switch the signal handler to threadsafe mode while the team is running.
+        bool switched_signal_mode = false;
+        if (n > 1 and not signaldata().inside_multithreaded_region())
+        {
+          signaldata().entering_multithreaded_region();
+          switched_signal_mode = true;
+        }
+
+        // Invalid points are caught and saved by the functors themselves inside a parallel region;
+        // anything else is caught here and rethrown once the team has finished.
+        #pragma omp parallel for schedule(dynamic,1) if(n > 1)
+        for (int i = 0; i < n; ++i)
+        {
+          functor* f = masterGraph[concurrent[i]];
+          logger() << LogTags::dependency_resolver << LogTags::info << LogTags::debug << "Calling "
+                   << f->name() << " from " << f->origin() << "..." << EOM;
+          if (serialVertices.find(concurrent[i]) != serialVertices.end())
+          {
+            #pragma omp critical (depresolver_serial_functors)
+            {
+              // Start the clock only once the lock is held, so that time spent waiting for other serial functors
+              // is not counted as runtime.
+              clock::time_point start = clock::now();
+              try { f->calculate(); }
+              catch (...)
+              {
+                #pragma omp critical (depresolver_parallel_error)
+                if (error == nullptr) error = std::current_exception();
+              }
+              runtimes[i] = std::chrono::duration<double>(clock::now() - start).count();
+            }
+          }
+          else
+          {
+            clock::time_point start = clock::now();
+            try { f->calculate(); }
+            catch (...)
+            {
+              #pragma omp critical (depresolver_parallel_error)
+              if (error == nullptr) error = std::current_exception();
+            }
+            runtimes[i] = std::chrono::duration<double>(clock::now() - start).count();
+          }
+        }
+
+        if (switched_signal_mode) signaldata().leaving_multithreaded_region();
+        if (error != nullptr) std::rethrow_exception(error);
+
+        for (int i = 0; i < n; ++i)
+        {
+          pointVertexRuntimes[concurrent[i]] += runtimes[i];
+          if (log_runtime)
+          {
+            logger() << LogTags::dependency_resolver << LogTags::info << "Runtime of " << masterGraph[concurrent[i]]->name()
+                     << ", averaged over multiple calls [s]: " << masterGraph[concurrent[i]]->getRuntimeAverage() << EOM;
+          }
+        }
+        for (int i = 0; i < n; ++i)
+        {
+          invalid_point_exception* e = masterGraph[concurrent[i]]->retrieve_invalid_point_exception();
+          if (e != NULL) throw(*e);
+        }
+      }
+    }
+
+    // Log the length of the critical path through the functors evaluated for the current point, and the total work done.
+    void DependencyResolver::reportCriticalPath()
+    {
+      double total_work = 0;
+      double critical_path = 0;
+      std::map<VertexID, double> longest_path_to;
+      for (auto it = function_order.begin(); it != function_order.end(); ++it)
+      {
+        auto runtime = pointVertexRuntimes.find(*it);
+        if (runtime == pointVertexRuntimes.end()) continue;
+        double longest_parent_path = 0;
+        graph_traits<DRes::MasterGraphType>::in_edge_iterator jt, jend;
+        for (boost::tie(jt, jend) = in_edges(*it, masterGraph); jt != jend; ++jt)
+        {
+          auto parent = longest_path_to.find(source(*jt, masterGraph));
+          if (parent != longest_path_to.end()) longest_parent_path = std::max(longest_parent_path, parent->second);
+        }
+        longest_path_to[*it] = longest_parent_path + runtime->second;
+        critical_path = std::max(critical_path, longest_path_to[*it]);
+        total_work += runtime->second;
+      }
+      logger() << LogTags::dependency_resolver << LogTags::info << "Functors evaluated for this point: " << pointVertexRuntimes.size()
+               << "; total work [s]: " << total_work << "; critical path [s]: " << critical_path
+               << "; maximum speed-up: " << (critical_path > 0 ? total_work/critical_path : 1.0) << EOM;
+    }
+
     // Prints the results of an ObsLike vertex
     void DependencyResolver::printObsLike(VertexID vertex, const int pointID)
     {
       // pointID is supplied by the scanner, and is used to tell the printer which model
       // point the results should be associated with.
 
-      if (SortedParentVertices.find(vertex) == SortedParentVertices.end())
+      auto plan = PrintPlan.find(vertex);
+      if (plan == PrintPlan.end())
         core_error().raise(LOCAL_INFO, "Tried to calculate a function not in or not at top of dependency graph.");
-      std::vector<VertexID> order = SortedParentVertices.at(vertex);
 
-      for (std::vector<VertexID>::iterator it = order.begin(); it != order.end(); ++it)
+      // Functors with void results were already weeded out when the plan was compiled.
+      for (functor* f : plan->second)
       {
-        std::ostringstream ss;
-        ss << "Printing " << masterGraph[*it]->name() << " from " << masterGraph[*it]->origin() << "...";
-        logger() << LogTags::dependency_resolver << LogTags::info << LogTags::debug << ss.str() << EOM;
+        logger() << LogTags::dependency_resolver << LogTags::info << LogTags::debug << "Printing "
+                 << f->name() << " from " << f->origin() << "..." << EOM;
 
-        if (not typeComp(masterGraph[*it]->type(),  "void", *boundTEs, false))
-        {
-          // Note that this prints from thread index 0 only, i.e. results created by
-          // threads other than the main one need to be accessed with
-          //   masterGraph[*it]->print(boundPrinter,pointID,index);
-          // where index is some integer s.t. 0 <= index <= number of hardware threads.
-          // At the moment GAMBIT only prints results of thread 0, under the expectation
-          // that nested module functions are all designed to gather their results into
-          // thread 0.
-          masterGraph[*it]->print(boundPrinter,pointID);
-        }
+        // Note that this prints from thread index 0 only, i.e. results created by
+        // threads other than the main one need to be accessed with
+        //   f->print(boundPrinter,pointID,index);
+        // where index is some integer s.t. 0 <= index <= number of hardware threads.
+        // At the moment GAMBIT only prints results of thread 0, under the expectation
+        // that nested module functions are all designed to gather their results into
+        // thread 0.
+        f->print(boundPrinter,pointID);
       }
     }
 
     /// Getter for print_timing flag (used by LikelihoodContainer)
     bool DependencyResolver::printTiming() { return print_timing; }
 
+    /// Getter for parallel_evaluation flag
+    bool DependencyResolver::parallelEvaluation() { return parallel_evaluation; }
+
     // Get the functor corresponding to a single VertexID
     functor* DependencyResolver::get_functor(VertexID id)
     {
+      // Vertices are stored contiguously, so any valid ID is less than the number of vertices.
+      if (id < num_vertices(masterGraph)) return masterGraph[id];
+      return NULL;
+    }
+
+    // Get the summed average runtime of all active functors that depend on a given functor
+    double DependencyResolver::getDownstreamRuntime(const functor* f)
+    {
+      std::set<VertexID> visited;
+      std::vector<VertexID> to_visit;
       graph_traits<DRes::MasterGraphType>::vertex_iterator vi, vi_end;
       for (boost::tie(vi, vi_end) = vertices(masterGraph); vi != vi_end; ++vi)
       {
-        if (*vi == id) return masterGraph[id];
+        if (masterGraph[*vi] == f) to_visit.push_back(*vi);
       }
-      return NULL;
+      double runtime = 0;
+      while (not to_visit.empty())
+      {
+        VertexID v = to_visit.back();
+        to_visit.pop_back();
+        graph_traits<DRes::MasterGraphType>::out_edge_iterator it, iend;
+        for (boost::tie(it, iend) = out_edges(v, masterGraph); it != iend; ++it)
+        {
+          VertexID child = target(*it, masterGraph);
+          if (not visited.insert(child).second or masterGraph[child]->status() != 2) continue;
+          // The runtime of nested functors is already included in that of their loop managers.
+          if (masterGraph[child]->loopManagerName() == "none") runtime += masterGraph[child]->getRuntimeAverage();
+          to_visit.push_back(child);
+        }
+      }
+      return runtime;
     }
 
     // Ensure that the type of a given vertex is equivalent to at least one of a provided list, and return the match.
@@ -833,11 +1010,299 @@ namespace Gambit
     // Resets all active functors and deletes existing results
     void DependencyResolver::resetAll()
     {
-      graph_traits<DRes::MasterGraphType>::vertex_iterator vi, vi_end;
-      for (boost::tie(vi, vi_end) = vertices(masterGraph); vi != vi_end; ++vi)
+      if (parallel_evaluation)
+      {
+        if (report_critical_path) reportCriticalPath();
+        pointVertexRuntimes.clear();
+      }
+      for (functor* f : activeFunctors) f->reset();
+      for (functor* f : memoisedFunctors)
+      {
+        // Results that invalidated the point must not be reused.
+        if (f->retrieve_invalid_point_exception() != NULL) f->reset();
+        else f->resetPrintFlags();
+      }
+    }
+
+    // Reset memoised functors whose model parameter inputs have changed since the previous point
+    void DependencyResolver::refreshMemoisedFunctors()
+    {
+      if (not memoise_functors) return;
+      std::vector<bool> stale(memoisedFunctors.size(), false);
+      for (auto& m : memoisedModels)
+      {
+        const ModelParameters& params = *(m.model->getcontentsPtr());
+        size_t npars = params.getNumberOfPars();
+        bool changed = (m.last_values.size() != npars);
+        if (changed) m.last_values.resize(npars);
+        auto last = m.last_values.begin();
+        for (auto it = params.begin(); it != params.end(); ++it, ++last)
+        {
+          if (*last != it->second)
+          {
+            *last = it->second;
+            changed = true;
+          }
+        }
+        if (changed) for (size_t i : m.dependents) stale[i] = true;
+      }
+      for (size_t i = 0; i < memoisedFunctors.size(); ++i)
+      {
+        // Only count a reuse if the result was actually computed at an earlier point (it may have been skipped there).
+        if (stale[i]) memoisedFunctors[i]->reset();
+        else if (memoisedFunctors[i]->resultAvailable()) memoisedReuses[i]++;
+      }
+      memoisedPoints++;
+    }
+
+    // Set the keys of the results for the current point in the persistent result cache
+    void DependencyResolver::updateResultCacheKeys()
+    {
+      for (auto& c : cachedFunctors)
+      {
+        // The key is the fixed prefix followed by the exact bytes of every parameter the result depends on.
+        str key = c.key_prefix;
+        for (primary_model_functor* model : c.models)
+        {
+          const ModelParameters& params = *(model->getcontentsPtr());
+          for (auto it = params.begin(); it != params.end(); ++it)
+          {
+            key.append(reinterpret_cast<const char*>(&it->second), sizeof(double));
+          }
+        }
+        if (fidelity_levels > 1) key.append(1, char(Utils::fidelity_level()));
+        c.functor->setResultCacheKey(key);
+      }
+    }
+
+    // Number of fidelity levels at which points can be computed
+    int DependencyResolver::fidelityLevels()
+    {
+      return fidelity_levels;
+    }
+
+    // Switch to computing the current point at the given fidelity level, and reset the functors whose results depend on it
+    void DependencyResolver::setFidelity(int level)
+    {
+      if (level == Utils::fidelity_level()) return;
+      Utils::set_fidelity_level(level);
+      for (functor* f : fidelityFunctors) f->setFidelity(level);
+      for (functor* f : fidelityDependents) f->reset();
+      updateResultCacheKeys();
+    }
+
+    // Report statistics gathered during the scan
+    void DependencyResolver::finalise()
+    {
+      if (memoise_functors and memoisedPoints > 0)
+      {
+        std::ostringstream ss;
+        ss << "Memoised functor results reused over " << memoisedPoints << " points:";
+        for (size_t i = 0; i < memoisedFunctors.size(); ++i)
+        {
+          ss << endl << "  " << memoisedFunctors[i]->origin() << "::" << memoisedFunctors[i]->name() << ": "
+             << memoisedReuses[i] << " (" << 100.0*memoisedReuses[i]/memoisedPoints << "%)";
+        }
+        logger() << LogTags::dependency_resolver << LogTags::info << ss.str() << EOM;
+      }
+      if (resultCache)
+      {
+        logger() << LogTags::dependency_resolver << LogTags::info << "Result cache " << resultCache->path() << ": "
+                 << resultCache->hits() << " hits, " << resultCache->misses() << " misses, "
+                 << resultCache->stores() << " results saved by this process." << EOM;
+      }
+      if (persist_runtime_stats) finaliseRuntimeStatistics();
+    }
+
+    // Seed the runtime and invalidation statistics of all active functors with those saved by a previous run.  Only the
+    // first process reads the file, and passes its contents on to the others.
+    void DependencyResolver::loadRuntimeStatistics()
+    {
+      runtime_stats_path = boundIniFile->getDefaultOutputPath() + "/runtime_stats/";
+      const str fname = runtime_stats_path + "runtime_stats.yaml";
+
+      // Memoised functors are taken out of activeFunctors later, so they need a list of their own.
+      runtimeStatsFunctors = activeFunctors;
+      std::sort(runtimeStatsFunctors.begin(), runtimeStatsFunctors.end(), [](functor* a, functor* b)
+      {
+        return a->origin() + "::" + a->name() < b->origin() + "::" + b->name();
+      });
+      const size_t n = runtimeStatsFunctors.size();
+      std::vector<double> saved(3*n, 0.0);
+
+      int rank = 0;
+      #ifdef WITH_MPI
+        runtimeStatsComm.dup(MPI_COMM_WORLD, "runtimeStatsComm");
+        rank = runtimeStatsComm.Get_rank();
+      #endif
+      if (rank == 0 and Utils::file_exists(fname))
+      {
+        try
+        {
+          std::map<str, size_t> index;
+          for (size_t i = 0; i < n; ++i) index[runtimeStatsFunctors[i]->origin() + "::" + runtimeStatsFunctors[i]->name()] = i;
+          YAML::Node node = YAML::LoadFile(fname);
+          // A file written before any point was finished still carries some information, so never give it zero weight.
+          double weight = std::max(1.0, node["points"].as<double>());
+          for (const auto& entry : node["functors"])
+          {
+            auto it = index.find(entry.first.as<str>());
+            if (it == index.end()) continue;
+            saved[3*it->second]   = weight*entry.second[0].as<double>();
+            saved[3*it->second+1] = weight*entry.second[1].as<double>();
+            saved[3*it->second+2] = weight;
+          }
+        }
+        catch (YAML::Exception& e)
+        {
+          logger() << LogTags::dependency_resolver << LogTags::warn << "Ignoring unreadable runtime statistics file " << fname << ": " << e.what() << EOM;
+        }
+      }
+      #ifdef WITH_MPI
+        if (n > 0) runtimeStatsComm.Bcast(saved, 3*n, 0);
+      #endif
+
+      if (applyRuntimeStatistics(saved))
+      {
+        logger() << LogTags::dependency_resolver << LogTags::info << "Likelihood ordering seeded with runtime statistics from " << fname << EOM;
+      }
+    }
+
+    // Every runtime_stats_interval points, start a non-blocking reduction of the runtime statistics over all processes,
+    // and apply its result at the first point after it completes.  Processes evaluate different numbers of points, so
+    // they start each reduction at different times; finaliseRuntimeStatistics makes sure all of them are completed.
+    bool DependencyResolver::syncRuntimeStatistics()
+    {
+      if (not persist_runtime_stats) return false;
+      ++runtime_stats_points;
+      #ifdef WITH_MPI
+        if (runtime_stats_pending)
+        {
+          if (not runtimeStatsComm.Test(&runtime_stats_request)) return false;
+          runtime_stats_pending = false;
+          return applyRuntimeStatistics(runtime_stats_sums);
+        }
+        if (runtime_stats_points % runtime_stats_interval == 0)
+        {
+          collectRuntimeStatistics();
+          runtimeStatsComm.Iallreduce(runtime_stats_local, runtime_stats_sums, MPI_SUM, &runtime_stats_request);
+          runtime_stats_pending = true;
+          runtime_stats_reductions++;
+        }
+      #endif
+      // With a single process there is nothing to share.
+      return false;
+    }
+
+    // Fill runtime_stats_local with this process' runtime statistics, weighted by the number of points behind them
+    void DependencyResolver::collectRuntimeStatistics()
+    {
+      const size_t n = runtimeStatsFunctors.size();
+      const double weight = std::max(1.0, double(runtime_stats_points));
+      runtime_stats_local.resize(3*n);
+      for (size_t i = 0; i < n; ++i)
+      {
+        runtime_stats_local[3*i]   = weight*runtimeStatsFunctors[i]->getRuntimeAverage();
+        runtime_stats_local[3*i+1] = weight*runtimeStatsFunctors[i]->getInvalidationRate();
+        runtime_stats_local[3*i+2] = weight;
+      }
+    }
+
+    // Set the runtime statistics of functors to the weighted averages held in sums
+    bool DependencyResolver::applyRuntimeStatistics(const std::vector<double>& sums)
+    {
+      bool changed = false;
+      for (size_t i = 0; i < runtimeStatsFunctors.size() and 3*i+2 < sums.size(); ++i)
       {
-        if (masterGraph[*vi]->status() == 2) masterGraph[*vi]->reset();
+        if (sums[3*i+2] <= 0) continue;
+        runtimeStatsFunctors[i]->setRuntimeAverage(sums[3*i]/sums[3*i+2]);
+        runtimeStatsFunctors[i]->setInvalidationRate(sums[3*i+1]/sums[3*i+2]);
+        changed = true;
       }
+      return changed;
+    }
+
+    #ifdef WITH_MPI
+      // Wait for a reduction of the runtime statistics to complete.  Returns false if a shutdown has begun or the
+      // other processes have not joined the reduction within runtime_stats_timeout.
+      bool DependencyResolver::waitForRuntimeStatistics(MPI_Request* request)
+      {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::duration<double>(runtime_stats_timeout);
+        while (not runtimeStatsComm.Test(request))
+        {
+          if (signaldata().check_if_shutdown_begun() or std::chrono::steady_clock::now() > deadline) return false;
+          std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return true;
+      }
+    #endif
+
+    // Average the runtime statistics over all processes one last time, and have the first process save the result
+    // (via a temporary file, so that a later run never sees a partial file).  Must be called by all processes that
+    // finished the scan.  Nothing is saved after an early shutdown, or if any process has left the scan without
+    // taking part; the reductions are then abandoned rather than waited for, so that no process hangs.
+    void DependencyResolver::finaliseRuntimeStatistics()
+    {
+      int rank = 0;
+      #ifdef WITH_MPI
+        rank = runtimeStatsComm.Get_rank();
+        if (signaldata().shutdown_begun())
+        {
+          logger() << LogTags::dependency_resolver << LogTags::info << "Runtime statistics not saved, as the scan was shut down early." << EOM;
+          return;
+        }
+        // Bring every process up to the same number of reductions, so that none is left waiting, then do a last one.
+        // The counts are compared over another communicator, as processes may still have reductions in flight on
+        // runtimeStatsComm and collectives on a communicator must be started in the same order everywhere.
+        GMPI::Comm world;
+        std::vector<int> mine(1, runtime_stats_reductions), most(1, 0);
+        MPI_Request request;
+        world.Iallreduce(mine, most, MPI_MAX, &request);
+        bool ok = waitForRuntimeStatistics(&request);
+        if (ok) do
+        {
+          if (runtime_stats_pending and not (ok = waitForRuntimeStatistics(&runtime_stats_request))) break;
+          collectRuntimeStatistics();
+          runtimeStatsComm.Iallreduce(runtime_stats_local, runtime_stats_sums, MPI_SUM, &runtime_stats_request);
+          runtime_stats_pending = true;
+        }
+        while (runtime_stats_reductions++ < most[0]);
+        if (ok) ok = waitForRuntimeStatistics(&runtime_stats_request);
+        if (not ok)
+        {
+          logger() << LogTags::dependency_resolver << LogTags::warn << "Runtime statistics not saved, as not all processes "
+                   "finished the scan within " << runtime_stats_timeout << " s." << EOM;
+          return;
+        }
+        runtime_stats_pending = false;
+      #else
+        collectRuntimeStatistics();
+        runtime_stats_sums = runtime_stats_local;
+      #endif
+      applyRuntimeStatistics(runtime_stats_sums);
+      if (rank != 0 or runtime_stats_path.empty()) return;
+
+      Utils::ensure_path_exists(runtime_stats_path);
+      const str fname = runtime_stats_path + "runtime_stats.yaml";
+      const str tmpname = fname + ".tmp";
+      {
+        std::ofstream out(tmpname);
+        out << std::setprecision(17);
+        out << "points: " << (runtime_stats_sums.empty() ? 0.0 : runtime_stats_sums[2]) << endl;
+        out << "functors:" << endl;
+        for (size_t i = 0; i < runtimeStatsFunctors.size(); ++i)
+        {
+          const double weight = runtime_stats_sums[3*i+2];
+          out << "  \"" << runtimeStatsFunctors[i]->origin() << "::" << runtimeStatsFunctors[i]->name() << "\": ["
+              << runtime_stats_sums[3*i]/weight << ", " << runtime_stats_sums[3*i+1]/weight << "]" << endl;
+        }
+        if (not out)
+        {
+          logger() << LogTags::dependency_resolver << LogTags::warn << "Could not write runtime statistics to " << tmpname << EOM;
+          return;
+        }
+      }
+      std::rename(tmpname.c_str(), fname.c_str());
     }
 
 
@@ -1589,10 +2054,23 @@ namespace Gambit
       use_regex      = boundIniFile->getValueOrDef<bool>(true,  "dependency_resolution", "use_regex");
       print_timing   = boundIniFile->getValueOrDef<bool>(false, "print_timing_data");
       print_unitcube = boundIniFile->getValueOrDef<bool>(false, "print_unitcube");
+      log_runtime    = boundIniFile->getValueOrDef<bool>(false, "dependency_resolution", "log_runtime");
+      parallel_evaluation  = boundIniFile->getValueOrDef<bool>(false, "dependency_resolution", "parallel_functor_evaluation");
+      memoise_functors     = boundIniFile->getValueOrDef<bool>(false, "dependency_resolution", "memoise_functors");
+      report_critical_path = boundIniFile->getValueOrDef<bool>(false, "dependency_resolution", "report_critical_path");
+      persist_runtime_stats  = boundIniFile->getValueOrDef<bool>(false, "dependency_resolution", "persist_runtime_statistics");
+      runtime_stats_interval = boundIniFile->getValueOrDef<long long>(1000, "dependency_resolution", "runtime_statistics_sync_interval");
+      #ifdef WITH_MPI
+        runtime_stats_timeout = boundIniFile->getValueOrDef<double>(60, "dependency_resolution", "runtime_statistics_timeout");
+      #endif
+      fidelity_levels        = boundIniFile->getValueOrDef<int>(1, "likelihood", "fidelity", "levels");
+      if (fidelity_levels < 1) dependency_resolver_error().raise(LOCAL_INFO, "The number of fidelity levels must be at least 1.");
 
       if ( use_regex      ) logger() << "Using regex for string comparison." << endl;
       if ( print_timing   ) logger() << "Will output timing information for all functors (via printer system)" << EOM;
       if ( print_unitcube ) logger() << "Printing of unitCubeParameters will be enabled." << EOM;
+      if ( parallel_evaluation ) logger() << "Independent functors will be evaluated concurrently." << EOM;
+      if ( memoise_functors ) logger() << "Functors will only be recomputed when their model parameter inputs change." << EOM;
 
       //
       // Main loop: repeat until dependency queue is empty
@@ -2347,6 +2825,8 @@ namespace Gambit
     void DependencyResolver::resolveRequirement(functor* func, VertexID vertex)
     {
       (*masterGraph[vertex]).resolveBackendReq(func);
+      vertexBackends[vertex].insert(func->origin());
+      vertexBackendVersions[vertex].insert(func->origin() + " " + func->version());
       logger() << LogTags::dependency_resolver;
       logger() << "Resolved by: [" << func->name() << ", ";
       logger() << func->origin() << " (" << func->version() << ")]";
@@ -2368,7 +2848,11 @@ namespace Gambit
       // Add the backends to list of required backends
       std::vector<sspair> resolvedBackends; 
       for(auto backend : (*masterGraph[vertex]).backendclassloading())
+      {
         resolvedBackends.push_back(backend);
+        vertexBackends[vertex].insert(backend.first);
+        vertexBackendVersions[vertex].insert(backend.first + " " + backend.second);
+      }
 
       bool found = false;
       for(auto br = backendsRequired.begin(); br != backendsRequired.end(); ++br)
@@ -2388,6 +2872,261 @@ namespace Gambit
 
     }
 
+    /// Flatten the resolved graph into the lists of functors walked for every point.
+    void DependencyResolver::compileExecutionPlan()
+    {
+      for (auto it = SortedParentVertices.begin(); it != SortedParentVertices.end(); ++it)
+      {
+        std::vector<functor*>& calc = ExecutionPlan[it->first];
+        std::vector<functor*>& print = PrintPlan[it->first];
+        calc.reserve(it->second.size());
+        for (auto jt = it->second.begin(); jt != it->second.end(); ++jt)
+        {
+          calc.push_back(masterGraph[*jt]);
+          if (not typeComp(masterGraph[*jt]->type(), "void", *boundTEs, false)) print.push_back(masterGraph[*jt]);
+        }
+      }
+      graph_traits<DRes::MasterGraphType>::vertex_iterator vi, vi_end;
+      for (boost::tie(vi, vi_end) = vertices(masterGraph); vi != vi_end; ++vi)
+      {
+        if (masterGraph[*vi]->status() == 2) activeFunctors.push_back(masterGraph[*vi]);
+      }
+    }
+
+    /// Work out which functors can keep their results between points, and which primary models they depend on.
+    /// A functor is memoised only if all of the functors it depends on are and at least one primary model is among
+    /// its ancestors, so that its inputs can only change when the parameters of one of those models do.
+    void DependencyResolver::setupMemoisation()
+    {
+      std::vector<str> never_memoise = boundIniFile->getValueOrDef<std::vector<str>>(std::vector<str>(), "dependency_resolution", "never_memoise");
+      std::map<VertexID, std::set<VertexID>> ancestor_models;
+      std::map<VertexID, size_t> model_index;
+      std::set<VertexID> memoised;
+
+      for (auto it = function_order.begin(); it != function_order.end(); ++it)
+      {
+        functor* f = masterGraph[*it];
+        if (f->status() != 2) continue;
+
+        // Primary model functors are the sources of the parameters; they are always reset as normal.
+        if (dynamic_cast<primary_model_functor*>(f) != NULL)
+        {
+          ancestor_models[*it].insert(*it);
+          model_index[*it] = memoisedModels.size();
+          memoisedModels.push_back({dynamic_cast<primary_model_functor*>(f), {}, {}});
+          memoised.insert(*it);
+          continue;
+        }
+
+        // Loop managers and nested functors are recomputed every time they are called, as are user-vetoed functors.
+        bool memoisable = not (f->canBeLoopManager() or f->loopManagerName() != "none" or
+         std::find(never_memoise.begin(), never_memoise.end(), f->origin() + "::" + f->name()) != never_memoise.end());
+        graph_traits<DRes::MasterGraphType>::in_edge_iterator jt, jend;
+        for (boost::tie(jt, jend) = in_edges(*it, masterGraph); memoisable and jt != jend; ++jt)
+        {
+          VertexID parent = source(*jt, masterGraph);
+          if (memoised.find(parent) == memoised.end()) memoisable = false;
+          else ancestor_models[*it].insert(ancestor_models[parent].begin(), ancestor_models[parent].end());
+        }
+        // Functors with no primary model upstream (e.g. random number draws, or reads of backend or global state)
+        // have no parameters to watch for changes, so they are recomputed at every point.
+        if (not memoisable or ancestor_models[*it].empty()) continue;
+
+        memoised.insert(*it);
+        for (VertexID model : ancestor_models[*it]) memoisedModels[model_index.at(model)].dependents.push_back(memoisedFunctors.size());
+        memoisedFunctors.push_back(f);
+      }
+      memoisedReuses.assign(memoisedFunctors.size(), 0);
+
+      // Memoised functors are no longer reset after every point.
+      std::set<functor*> memoised_functors(memoisedFunctors.begin(), memoisedFunctors.end());
+      activeFunctors.erase(std::remove_if(activeFunctors.begin(), activeFunctors.end(),
+       [&](functor* f) { return memoised_functors.find(f) != memoised_functors.end(); }), activeFunctors.end());
+
+      logger() << LogTags::dependency_resolver << LogTags::info << memoisedFunctors.size() << " of "
+               << activeFunctors.size() + memoisedFunctors.size() << " active functors will be memoised." << EOM;
+    }
+
+    /// Open the persistent result cache, and work out what the results of the functors using it depend on.  A result is
+    /// assumed to be fully determined by the parameters of the primary models upstream of it, and by the identity, options,
+    /// sub-capabilities and backends of every functor upstream of it (including those nested inside upstream loops).
+    void DependencyResolver::setupResultCache()
+    {
+      std::vector<str> cached = boundIniFile->getValueOrDef<std::vector<str>>(std::vector<str>(), "dependency_resolution", "result_cache", "functors");
+      if (cached.empty()) return;
+      str path = boundIniFile->getValueOrDef<str>(boundIniFile->getDefaultOutputPath() + "/result_cache/", "dependency_resolution", "result_cache", "path");
+      double max_size = boundIniFile->getValueOrDef<double>(1000, "dependency_resolution", "result_cache", "max_size_MB");
+      resultCache.reset(new Utils::result_cache(path, std::uint64_t(max_size*1024*1024)));
+
+      for (auto it = function_order.begin(); it != function_order.end(); ++it)
+      {
+        functor* f = masterGraph[*it];
+        const str fname = f->origin() + "::" + f->name();
+        if (std::find(cached.begin(), cached.end(), fname) == cached.end()) continue;
+        module_functor_common* mf = dynamic_cast<module_functor_common*>(f);
+        if (mf == NULL or not mf->resultIsCacheable() or f->canBeLoopManager() or f->loopManagerName() != "none")
+        {
+          logger() << LogTags::dependency_resolver << LogTags::warn << "The results of " << fname << " will not be cached, as "
+                   << "only module functions outside of loops and returning numbers, strings or std containers of them can be." << EOM;
+          continue;
+        }
+
+        // Collect everything upstream of this functor.
+        std::set<VertexID> upstream;
+        std::vector<VertexID> todo(1, *it);
+        while (not todo.empty())
+        {
+          VertexID v = todo.back();
+          todo.pop_back();
+          std::vector<VertexID> next;
+          graph_traits<DRes::MasterGraphType>::in_edge_iterator jt, jend;
+          for (boost::tie(jt, jend) = in_edges(v, masterGraph); jt != jend; ++jt) next.push_back(source(*jt, masterGraph));
+          if (loopManagerMap.find(v) != loopManagerMap.end()) next.insert(next.end(), loopManagerMap.at(v).begin(), loopManagerMap.at(v).end());
+          for (VertexID u : next) if (upstream.insert(u).second) todo.push_back(u);
+        }
+        upstream.insert(*it);
+
+        CachedFunctorInfo info;
+        info.functor = mf;
+        std::ostringstream id;
+        for (VertexID v : sortVertices(upstream, function_order))
+        {
+          functor* g = masterGraph[v];
+          id << g->origin() << "::" << g->name() << " " << g->version() << " " << g->type() << endl
+             << YAML::Dump(g->getOptions()->getNode()) << endl << YAML::Dump(g->getSubCaps()->getNode()) << endl;
+          if (vertexBackendVersions.find(v) != vertexBackendVersions.end())
+          {
+            for (const str& be : vertexBackendVersions.at(v)) id << be << endl;
+          }
+          primary_model_functor* model = dynamic_cast<primary_model_functor*>(g);
+          if (model != NULL)
+          {
+            info.models.push_back(model);
+            for (const str& par : model->getcontentsPtr()->getKeys()) id << par << endl;
+          }
+        }
+        std::ostringstream prefix;
+        prefix << std::hex << std::setw(16) << std::setfill('0') << Utils::fnv1a_hash(id.str()) << ":";
+        info.key_prefix = prefix.str();
+
+        mf->setResultCache(resultCache.get());
+        cachedFunctors.push_back(info);
+      }
+
+      logger() << LogTags::dependency_resolver << LogTags::info << "Results of " << cachedFunctors.size()
+               << " functors will be kept in the result cache in " << resultCache->path() << EOM;
+    }
+
+    /// Give the functors with a 'fidelity' entry in their options their options at each fidelity level, and work out
+    /// which functors must be recomputed when the level changes.  These are the functors with such options, the loop
+    /// managers running any functor that must be recomputed, and everything downstream of them.
+    void DependencyResolver::setupFidelity()
+    {
+      Utils::set_fidelity_levels(fidelity_levels);
+
+      std::set<VertexID> dependents;
+      std::vector<VertexID> todo;
+      graph_traits<DRes::MasterGraphType>::vertex_iterator vi, vi_end;
+      for (boost::tie(vi, vi_end) = vertices(masterGraph); vi != vi_end; ++vi)
+      {
+        functor* f = masterGraph[*vi];
+        if (f->status() != 2 or not f->getOptions()->hasKey("fidelity")) continue;
+        f->setFidelityLevels(fidelity_levels);
+        f->setFidelity(fidelity_levels - 1);
+        fidelityFunctors.push_back(f);
+        if (dependents.insert(*vi).second) todo.push_back(*vi);
+      }
+
+      while (not todo.empty())
+      {
+        VertexID v = todo.back();
+        todo.pop_back();
+        std::vector<VertexID> next;
+        graph_traits<DRes::MasterGraphType>::out_edge_iterator jt, jend;
+        for (boost::tie(jt, jend) = out_edges(v, masterGraph); jt != jend; ++jt) next.push_back(target(*jt, masterGraph));
+        for (const auto& lm : loopManagerMap)
+        {
+          if (lm.second.find(v) != lm.second.end()) next.push_back(lm.first);
+        }
+        for (VertexID u : next) if (dependents.insert(u).second) todo.push_back(u);
+      }
+      for (VertexID v : sortVertices(dependents, function_order)) fidelityDependents.push_back(masterGraph[v]);
+
+      logger() << LogTags::dependency_resolver << LogTags::info << "Points can be computed at " << fidelity_levels
+               << " fidelity levels.  " << fidelityFunctors.size() << " functors have options for each level, and "
+               << fidelityDependents.size() << " depend on the level." << EOM;
+    }
+
+    /// Sort the vertices needed by each ObsLike into levels, such that every vertex depends only
+    /// on vertices in earlier levels.  All vertices within a level can be evaluated concurrently.
+    void DependencyResolver::setupParallelEvaluation()
+    {
+      std::vector<str> serial_functors = boundIniFile->getValueOrDef<std::vector<str>>(std::vector<str>(), "dependency_resolution", "serial_functors");
+      // Backends listed as threadsafe in the yaml file are registered with the backend functors, which decide for both
+      // the scheduling here and the locking of backend calls.  A frontend's declaration that it is not reentrant wins.
+      for (const str& be : boundIniFile->getValueOrDef<std::vector<str>>(std::vector<str>(), "dependency_resolution", "threadsafe_backends"))
+      {
+        if (backend_not_reentrant(be))
+        {
+          std::ostringstream errmsg;
+          errmsg << "Backend " << be << " is listed in threadsafe_backends, but its frontend declares it not reentrant.";
+          dependency_resolver_error().raise(LOCAL_INFO,errmsg.str());
+        }
+        set_backend_threadsafe(be);
+      }
+
+      std::ostringstream ss;
+      ss << "Functors that will not be run concurrently with each other:";
+      for (auto it = function_order.begin(); it != function_order.end(); ++it)
+      {
+        functor* f = masterGraph[*it];
+        if (f->canBeLoopManager() or f->loopManagerName() != "none")
+        {
+          outOfRegionVertices.insert(*it);
+          continue;
+        }
+        // Module functions using a backend are assumed to be non-reentrant, unless all
+        // of the backends they use are threadsafe.
+        bool serial = std::find(serial_functors.begin(), serial_functors.end(), f->origin() + "::" + f->name()) != serial_functors.end();
+        if (vertexBackends.find(*it) != vertexBackends.end())
+        {
+          for (auto be = vertexBackends.at(*it).begin(); be != vertexBackends.at(*it).end(); ++be)
+          {
+            if (not backend_is_threadsafe(*be)) serial = true;
+          }
+        }
+        if (serial)
+        {
+          serialVertices.insert(*it);
+          ss << endl << "  " << f->origin() << "::" << f->name();
+        }
+      }
+      logger() << LogTags::dependency_resolver << LogTags::info << ss.str() << EOM;
+
+      for (auto it = SortedParentVertices.begin(); it != SortedParentVertices.end(); ++it)
+      {
+        std::map<VertexID, unsigned int> level;
+        std::vector<std::vector<VertexID>>& levels = ParallelLevels[it->first];
+        // The vertices are already sorted topologically, so all parents of a vertex have been assigned a level by the time it is reached.
+        for (auto jt = it->second.begin(); jt != it->second.end(); ++jt)
+        {
+          unsigned int mylevel = 0;
+          graph_traits<DRes::MasterGraphType>::in_edge_iterator kt, kend;
+          for (boost::tie(kt, kend) = in_edges(*jt, masterGraph); kt != kend; ++kt)
+          {
+            auto parent = level.find(source(*kt, masterGraph));
+            if (parent != level.end()) mylevel = std::max(mylevel, parent->second + 1);
+          }
+          level[*jt] = mylevel;
+          if (levels.size() <= mylevel) levels.resize(mylevel + 1);
+          levels[mylevel].push_back(*jt);
+        }
+        logger() << LogTags::dependency_resolver << LogTags::info << masterGraph[it->first]->origin() << "::"
+                 << masterGraph[it->first]->name() << " requires " << it->second.size() << " functors in "
+                 << levels.size() << " sequential levels." << EOM;
+      }
+    }
+
     // Get BibTeX citation keys for backends, modules, etc
     void DependencyResolver::getCitationKeys()
     {
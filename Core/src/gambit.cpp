@@ -17,6 +17,7 @@
 
 #include "gambit/Core/gambit.hpp"
 #include "gambit/Utils/mpiwrapper.hpp"
+#include "gambit/Utils/profiler.hpp"
 
 
 using namespace Gambit;
@@ -30,6 +31,7 @@ using namespace LogTags;
 void do_cleanup()
 {
   Gambit::Scanner::Plugins::plugin_info.dump(); // Also calls printer finalise() routine
+  Gambit::Utils::profiler().finalise();
 }
 
 
@@ -159,6 +161,10 @@ int main(int argc, char* argv[])
       int seed = rng.getValueOrDef<int>(-1, "seed");
       Random::create_rng_engine(generator, seed);
 
+      // Set up the profiler, which records a fraction of points (none by default).
+      Utils::profiler().configure(iniFile.getValueOrDef<double>(0., "profiler", "sample_fraction"), rank,
+                                  iniFile.getDefaultOutputPath() + "/profiles/");
+
       // Determine selected model(s)
       std::set<str> selectedmodels = iniFile.getModelNames();
 
@@ -220,6 +226,8 @@ int main(int argc, char* argv[])
         if (rank == 0) std::cerr << "Starting scan." << std::endl;
         scan.Run(); // Note: the likelihood container will unblock signals when it is safe to receive them.
         logger().enable(); // Turn logs back on (in case they were disabled for speed)
+        dependencyResolver.finalise();
+        Utils::profiler().finalise();
         // Check why we have exited the scanner; scan may have been terminated early by a signal.
         // We assume here that because the scanner has exited that it has already down whatever
         // cleanup it requires, including finalising the printers, i.e. the 'do_cleanup()' function will NOT run.
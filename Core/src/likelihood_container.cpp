@@ -37,6 +37,7 @@
 #include "gambit/Utils/signal_handling.hpp"
 #include "gambit/Utils/mpiwrapper.hpp"
 #include "gambit/Utils/lnlike_modifiers.hpp"
+#include "gambit/Utils/profiler.hpp"
 
 //#define CORE_DEBUG
 
@@ -58,6 +59,7 @@ namespace Gambit
     print_invalid_points             (iniFile.getValueOrDef<bool>(true, "likelihood", "print_invalid_points")),
     disable_print_for_lnlike_below   (iniFile.getValueOrDef<double>(min_valid_lnlike, "likelihood", "disable_print_for_lnlike_below")),
     lnlike_modifier_name             (iniFile.getValueOrDef<str>("identity", "likelihood", "use_lnlike_modifier")),
+    print_timing                     (dependencyResolver.printTiming()),
     intralooptime_label              ("Runtime(ms) intraloop"),
     interlooptime_label              ("Runtime(ms) interloop"),
     totallooptime_label              ("Runtime(ms) totalloop"),
@@ -68,6 +70,12 @@ namespace Gambit
     interloopID(Printers::get_main_param_id(interlooptime_label)),
     totalloopID(Printers::get_main_param_id(totallooptime_label)),
     invalidcodeID(Printers::get_main_param_id("Invalidation Code")),
+    fidelity_levels                  (dependencyResolver.fidelityLevels()),
+    fidelity_policy                  (iniFile.getValueOrDef<str>("scanner", "likelihood", "fidelity", "policy")),
+    fidelity_margin                  (iniFile.getValueOrDef<double>(5., "likelihood", "fidelity", "margin")),
+    fidelity_delta_lnlike            (iniFile.getValueOrDef<double>(50., "likelihood", "fidelity", "delta_lnlike")),
+    best_full_fidelity_lnlike        (-std::numeric_limits<double>::infinity()),
+    fidelityID(Printers::get_main_param_id("Fidelity")),
     #ifdef CORE_DEBUG
       debug            (true)
     #else
@@ -79,34 +87,52 @@ namespace Gambit
     {
       lnlike_modifier_params = Options(iniFile.getValue<YAML::Node>("likelihood", "lnlike_modifiers", lnlike_modifier_name));
     }
+    if (fidelity_policy != "scanner" and fidelity_policy != "promote")
+    {
+      core_error().raise(LOCAL_INFO, "Unknown fidelity policy '" + fidelity_policy + "'.  The options are 'scanner' and 'promote'.");
+    }
     // Set the list of valid return types of functions that can be used for 'purpose' by this container class.
     const std::vector<str> allowed_types_for_purpose = initVector<str>("double", "std::vector<double>", "float", "std::vector<float>");
     // Find subset of vertices that match requested purpose
     auto all_vertices = dependencyResolver.getObsLikeOrder();
     for (auto it = all_vertices.begin(); it != all_vertices.end(); ++it)
     {
+      functor* f = dependencyResolver.get_functor(*it);
       if (dependencyResolver.getIniEntry(*it)->purpose == purpose)
       {
-        return_types[*it] = dependencyResolver.checkTypeMatch(*it, purpose, allowed_types_for_purpose);
+        // Resolve the return type once here, rather than by string comparison for every point.
+        str rtype = dependencyResolver.checkTypeMatch(*it, purpose, allowed_types_for_purpose);
+        if      (rtype == "double")              return_types.push_back(lnlike_type::dbl);
+        else if (rtype == "std::vector<double>") return_types.push_back(lnlike_type::vec_dbl);
+        else if (rtype == "float")               return_types.push_back(lnlike_type::flt);
+        else if (rtype == "std::vector<float>")  return_types.push_back(lnlike_type::vec_flt);
+        else core_error().raise(LOCAL_INFO, "Unexpected target functor type.");
+        target_tags.push_back("ikelihood contribution from " + f->origin() + "::" + f->name());
+        upper_bounds.push_back(dependencyResolver.getIniEntry(*it)->lnlike_upper_bound);
         target_vertices.push_back(std::move(*it));
       }
       else
       {
+        aux_tags.push_back("dditional observable from " + f->origin() + "::" + f->name());
         aux_vertices.push_back(std::move(*it));
       }
     }
+    setRemainingUpperBounds();
+  }
+
+  /// Destructor
+  Likelihood_Container::~Likelihood_Container()
+  {
+    // Stop exceptions asking this object for the parameter values.
+    exception::set_parameters("");
   }
 
   /// Do the prior transformation and populate the parameter map
   void Likelihood_Container::setParameters (const std::unordered_map<std::string, double> &parameterMap)
   {
-    // Set up a stream containing the parameter values, for diagnostic output
-    std::ostringstream parstream;
-
     // Iterate over the primary_model_parameters functors of all the models being scanned.
     for (auto act_it = functorMap.begin(), act_end = functorMap.end(); act_it != act_end; act_it++)
     {
-      parstream << "  " << act_it->first << ":" << endl;
       // Get the names of the parameters for this model.
       auto paramkeys = act_it->second->getcontentsPtr()->getKeys();
       // Iterate over the parameters, setting their values in the primary_model_parameters functors from the parameterMap.
@@ -128,35 +154,97 @@ namespace Gambit
            }
            core_error().raise(LOCAL_INFO,err.str());
         }
-        parstream << "    " << *par_it << ": " << tmp_it->second << endl;
         act_it->second->getcontentsPtr()->setValue(*par_it, tmp_it->second);
       }
     }
+    reportParameters();
+  }
+
+  /// Set the values of the parameters from an array, in the order given to setParameterOrder
+  void Likelihood_Container::setParameters (const double *physical)
+  {
+    for (const parameter_slot &slot : parameter_slots)
+    {
+      slot.params->setValue(slot.index, physical[slot.position]);
+    }
+    reportParameters();
+  }
 
-    // Notify all exceptions of the values of the parameters for this point.
-    exception::set_parameters("\n\nYAML-ready parameter values at failed point:\n"+parstream.str());
+  /// Make the values of the parameters available to exceptions and debug output
+  void Likelihood_Container::reportParameters()
+  {
+    // Notify all exceptions of the values of the parameters for this point.  The string is only built if needed.
+    exception::set_parameters([this]() { return "\n\nYAML-ready parameter values at failed point:\n" + parameterString(); });
 
     // Print out the MPI rank and values of the parameters for this point if in debug mode.
     if (debug)
     {
+      str parstring = parameterString();
       #ifdef WITH_MPI
         GMPI::Comm COMM_WORLD;
         std::cout << "MPI process rank: "<< COMM_WORLD.Get_rank() << std::endl;
       #endif
-      cout << parstream.str();
-      logger() << LogTags::core << "\nBeginning computations for parameter point:\n" << parstream.str() << EOM;
+      cout << parstring;
+      logger() << LogTags::core << "\nBeginning computations for parameter point:\n" << parstring << EOM;
     }
-    // Print the parameter point to the logs, even if not in debug mode
-    //logger() << LogTags::core << "\nBeginning computations for parameter point:\n" << parstream.str() << EOM;
+  }
 
+  /// Get the current values of the parameters, in a YAML-ready string
+  str Likelihood_Container::parameterString() const
+  {
+    std::ostringstream parstream;
+    for (auto act_it = functorMap.begin(), act_end = functorMap.end(); act_it != act_end; act_it++)
+    {
+      parstream << "  " << act_it->first << ":" << endl;
+      const ModelParameters &params = *(act_it->second->getcontentsPtr());
+      for (ModelParameters::const_iterator par_it = params.begin(); par_it != params.end(); ++par_it)
+      {
+        parstream << "    " << par_it->first << ": " << par_it->second << endl;
+      }
+    }
+    return parstream.str();
+  }
 
+  /// Fix the order of the parameters passed to main_array
+  bool Likelihood_Container::setParameterOrder(const std::vector<std::string> &names)
+  {
+    parameter_slots.clear();
+    for (auto act_it = functorMap.begin(), act_end = functorMap.end(); act_it != act_end; act_it++)
+    {
+      ModelParameters *params = act_it->second->getcontentsPtr();
+      for (ModelParameters::const_iterator par_it = params->begin(); par_it != params->end(); ++par_it)
+      {
+        auto name_it = std::find(names.begin(), names.end(), act_it->first + "::" + par_it->first);
+        // Leave it to the map interface to report any missing parameter.
+        if (name_it == names.end()) return false;
+        parameter_slots.push_back({params, params->getIndex(par_it->first), size_t(name_it - names.begin())});
+      }
+    }
+    return true;
   }
 
   /// Evaluate total likelihood function
   double Likelihood_Container::main(std::unordered_map<std::string, double> &in)
+  {
+    setParameters(in);
+    return evaluate();
+  }
+
+  /// Evaluate total likelihood function, with parameters given in the order fixed by setParameterOrder
+  double Likelihood_Container::main_array(const double *physical)
+  {
+    setParameters(physical);
+    return evaluate();
+  }
+
+  /// Evaluate total likelihood function at the parameters already set
+  double Likelihood_Container::evaluate()
   {
     logger() << LogTags::core << LogTags::debug << "Entered Likelihood_Container::main" << EOM;
 
+    // Decide whether to profile this point.
+    Utils::profiler().begin_point();
+
     double lnlike = 0;
     bool point_invalidated = false;
 
@@ -195,125 +283,176 @@ namespace Gambit
 
       bool compute_aux = true;
 
-      // Set the values of the parameter point in the PrimaryParameters functor, and log them to cout and/or the logs if desired.
-      setParameters(in);
+      // Throw away any memoised results that depend on parameters that have changed since the last point.
+      dependencyResolver.refreshMemoisedFunctors();
+
+      // Tell functors using the persistent result cache where to find their results for this point.
+      dependencyResolver.updateResultCacheKeys();
 
       // Logger debug output; things labelled 'LogTags::debug' only get logged if the logger::debug or master debug flags are true, not if only 'likelihood::debug' is true.
       logger() << LogTags::core << LogTags::debug << "Number of target vertices to calculate:    " << target_vertices.size() << endl
                                                   << "Number of auxiliary vertices to calculate: " << aux_vertices.size() << EOM;
 
+      // Get the lowest total log-likelihood that the scanner will accept.  This is only meaningful if the
+      // total is passed on unmodified (the scanner applies any offset itself).
+      const double lnlike_threshold = (lnlike_modifier_name == "identity" ? getLnLikeThreshold() : -std::numeric_limits<double>::infinity());
+
+      // Choose the fidelity level to start at: the one requested by the scanner if any, otherwise full accuracy, or the
+      // lowest level if points are to be promoted.  Points are only promoted while they may reach the threshold, which
+      // is put below the best point so far if the scanner has not set one.
+      const int full_fidelity = fidelity_levels - 1;
+      int fidelity = getFidelity();
+      if (fidelity < 0 or fidelity > full_fidelity) fidelity = (fidelity_policy == "promote" ? 0 : full_fidelity);
+      dependencyResolver.setFidelity(fidelity);
+      const double promote_threshold = (lnlike_threshold > -std::numeric_limits<double>::infinity() ?
+       lnlike_threshold : best_full_fidelity_lnlike - fidelity_delta_lnlike) - fidelity_margin;
+
       // Begin timing of total likelihood evaluation
       std::chrono::time_point<std::chrono::system_clock> startL = std::chrono::system_clock::now();
 
       // Compute time since the previous likelihood evaluation ended
       std::chrono::duration<double> interloop_time = startL - previous_endL;
 
-      // First work through the target functors, i.e. the ones contributing to the likelihood.
-      for (auto it = target_vertices.begin(), end = target_vertices.end(); it != end; ++it)
+      // Work through the target functors, i.e. the ones contributing to the likelihood, at each fidelity level in turn.
+      for (;;)
       {
-        // Log the likelihood being tried.
-        str likelihood_tag = "ikelihood contribution from " + dependencyResolver.get_functor(*it)->origin()
-                             + "::" + dependencyResolver.get_functor(*it)->name();
-        if (debug) logger() << LogTags::core << "Calculating l" << likelihood_tag << "." << EOM;
+        lnlike = 0;
+
+        // Below full fidelity, the result may be off by up to the margin, so allow for that when skipping likelihoods.
+        const double skip_threshold = lnlike_threshold - (fidelity < full_fidelity ? fidelity_margin : 0.);
 
-        try
+        for (size_t i = 0, n = target_vertices.size(); i != n; ++i)
         {
-          // Set up debug output streams.
-          std::ostringstream debug_to_cout;
-          if (debug) debug_to_cout << "  L" << likelihood_tag << ": ";
+          const DRes::VertexID vertex = target_vertices[i];
+          const str& likelihood_tag = target_tags[i];
 
-          // Calculate the likelihood component.
-          dependencyResolver.calcObsLike(*it);
+          // Log the likelihood being tried.
+          if (debug) logger() << LogTags::core << "Calculating l" << likelihood_tag << "." << EOM;
 
-          // Switch depending on whether the functor returns floats or doubles and a single likelihood or a vector of them.
-          str rtype = return_types[*it];
-          if (rtype == "double")
-          {
-            double result = dependencyResolver.getObsLike<double>(*it);
-            if (debug) debug_to_cout << result;
-            lnlike += result;
-          }
-          else if (rtype == "std::vector<double>")
+          try
           {
-            std::vector<double> result = dependencyResolver.getObsLike<std::vector<double> >(*it);
-            for (auto jt = result.begin(); jt != result.end(); ++jt)
+            // Set up debug output streams.
+            std::ostringstream debug_to_cout;
+            if (debug) debug_to_cout << "  L" << likelihood_tag << ": ";
+
+            // Calculate the likelihood component.
+            dependencyResolver.calcObsLike(vertex);
+
+            // Switch depending on whether the functor returns floats or doubles and a single likelihood or a vector of them.
+            switch (return_types[i])
             {
-              if (debug) debug_to_cout << *jt << " ";
-              lnlike += *jt;
+              case lnlike_type::dbl:
+              {
+                double result = dependencyResolver.getObsLike<double>(vertex);
+                if (debug) debug_to_cout << result;
+                lnlike += result;
+                break;
+              }
+              case lnlike_type::vec_dbl:
+              {
+                const std::vector<double>& result = dependencyResolver.getObsLike<std::vector<double> >(vertex);
+                for (auto jt = result.begin(); jt != result.end(); ++jt)
+                {
+                  if (debug) debug_to_cout << *jt << " ";
+                  lnlike += *jt;
+                }
+                break;
+              }
+              case lnlike_type::flt:
+              {
+                float result = dependencyResolver.getObsLike<float>(vertex);
+                if (debug) debug_to_cout << result;
+                lnlike += result;
+                break;
+              }
+              case lnlike_type::vec_flt:
+              {
+                const std::vector<float>& result = dependencyResolver.getObsLike<std::vector<float> >(vertex);
+                for (auto jt = result.begin(); jt != result.end(); ++jt)
+                {
+                  if (debug) debug_to_cout << *jt << " ";
+                  lnlike += *jt;
+                }
+                break;
+              }
             }
-          }
-          else if (rtype == "float")
-          {
-            float result = dependencyResolver.getObsLike<float>(*it);
-            if (debug) debug_to_cout << result;
-            lnlike += result;
-          }
-          else if (rtype == "std::vector<float>")
-          {
-            std::vector<float> result = dependencyResolver.getObsLike<std::vector<float> >(*it);
-            for (auto jt = result.begin(); jt != result.end(); ++jt)
+
+            // Print debug info
+            if (debug) cout << debug_to_cout.str() << endl;
+
+            // Don't just roll over if it's a NaN, kill the scan and force the developer to fix it.
+            if (Utils::isnan(lnlike))
             {
-              if (debug) debug_to_cout << *jt << " ";
-              lnlike += *jt;
+              core_error().raise(LOCAL_INFO, "L" + likelihood_tag + " is NaN!");
             }
-          }
-          else core_error().raise(LOCAL_INFO, "Unexpected target functor type.");
 
-          // Print debug info
-          if (debug) cout << debug_to_cout.str() << endl;
+            // If we've dropped below the likelihood corresponding to effective zero already, skip the rest of the vertices.
+            if (lnlike <= active_min_valid_lnlike) dependencyResolver.invalidatePointAt(vertex, false);
 
-          // Don't just roll over if it's a NaN, kill the scan and force the developer to fix it.
-          if (Utils::isnan(lnlike))
-          {
-            core_error().raise(LOCAL_INFO, "L" + likelihood_tag + " is NaN!");
-          }
+            // If the remaining likelihoods cannot bring the total up to the scanner's threshold, skip them too.
+            if (lnlike + remaining_upper_bounds[i] < skip_threshold)
+            {
+              logger() << LogTags::core << LogTags::info << "Total lnL cannot exceed the scanner threshold (" << skip_threshold
+                       << "); skipping the remaining likelihoods." << EOM;
+              dependencyResolver.invalidatePointAt(vertex, false);
+            }
 
-          // If we've dropped below the likelihood corresponding to effective zero already, skip the rest of the vertices.
-          if (lnlike <= active_min_valid_lnlike) dependencyResolver.invalidatePointAt(*it, false);
+            // Log completion of this likelihood.
+            if (debug) logger() << LogTags::core << "Computed l" << likelihood_tag << "." << EOM;
+          }
 
-          // Log completion of this likelihood.
-          if (debug) logger() << LogTags::core << "Computed l" << likelihood_tag << "." << EOM;
+          // Catch points that are invalid, either due to low like or pathology.  Skip the rest of the vertices if a point is invalid.
+          catch(invalid_point_exception& e)
+          {
+            logger() << LogTags::core << LogTags::info << "Point invalidated by " << e.thrower()->origin() << "::" << e.thrower()->name() << ": " << e.message() << "Invalidation code " << e.invalidcode << EOM;
+            logger().leaving_module();
+            lnlike = active_min_valid_lnlike;
+            compute_aux = false;
+            point_invalidated = true;
+            int rankinv = printer.getRank();
+            // If print_ivalid_points is false disable the printer
+            if(!print_invalid_points)
+              printer.disable();
+            printer.print(e.invalidcode, "Invalidation Code", invalidcodeID, rankinv, getPtID());
+            if (debug) cout << "Point invalid. Invalidation code: " << e.invalidcode << endl;
+            break;
+          }
         }
 
-        // Catch points that are invalid, either due to low like or pathology.  Skip the rest of the vertices if a point is invalid.
-        catch(invalid_point_exception& e)
-        {
-          logger() << LogTags::core << "Point invalidated by " << e.thrower()->origin() << "::" << e.thrower()->name() << ": " << e.message() << "Invalidation code " << e.invalidcode << EOM;
-          logger().leaving_module();
-          lnlike = active_min_valid_lnlike;
-          compute_aux = false;
-          point_invalidated = true;
-          int rankinv = printer.getRank();
-          // If print_ivalid_points is false disable the printer
-          if(!print_invalid_points)
-            printer.disable();
-          printer.print(e.invalidcode, "Invalidation Code", invalidcodeID, rankinv, getPtID());
-          if (debug) cout << "Point invalid. Invalidation code: " << e.invalidcode << endl;
-          break;
-        }
+        // Recompute the point at the next fidelity level if it may reach the threshold.  Only the functors that depend
+        // on the level are reset; the rest keep their results.
+        if (point_invalidated or fidelity_policy != "promote" or fidelity == full_fidelity or lnlike < promote_threshold) break;
+        logger() << LogTags::core << LogTags::info << "Total lnL at fidelity level " << fidelity << " is " << lnlike
+                 << "; recomputing at level " << fidelity + 1 << "." << EOM;
+        dependencyResolver.setFidelity(++fidelity);
       }
 
+      // Record the fidelity level of the point.
+      if (fidelity_levels > 1)
+      {
+        printer.print(fidelity, "Fidelity", fidelityID, printer.getRank(), getPtID());
+        if (fidelity == full_fidelity and not point_invalidated) best_full_fidelity_lnlike = std::max(best_full_fidelity_lnlike, lnlike);
+      }
 
       // If none of the likelihood calculations have invalidated the point, calculate the additional auxiliary observables.
       if (compute_aux)
       {
         if (debug) logger() << LogTags::core <<  "Completed likelihoods.  Calculating additional observables." << EOM;
 
-        for (auto it = aux_vertices.begin(), end = aux_vertices.end(); it != end; ++it)
+        for (size_t i = 0, n = aux_vertices.size(); i != n; ++i)
         {
           // Log the observables being tried.
-          str aux_tag = "dditional observable from " + dependencyResolver.get_functor(*it)->origin()
-                               + "::" + dependencyResolver.get_functor(*it)->name();
+          const str& aux_tag = aux_tags[i];
           if (debug) logger() << LogTags::core <<  "Calculating a" << aux_tag << "." << EOM;
 
           try
           {
-            dependencyResolver.calcObsLike(*it);
+            dependencyResolver.calcObsLike(aux_vertices[i]);
             if (debug) logger() << LogTags::core << "Computed a" << aux_tag << "." << EOM;
           }
           catch(Gambit::invalid_point_exception& e)
           {
-            logger() << LogTags::core << "Additional observable invalidated by " << e.thrower()->origin()
+            logger() << LogTags::core << LogTags::info << "Additional observable invalidated by " << e.thrower()->origin()
                      << "::" << e.thrower()->name() << ": " << e.message() << "Invalidation code " << e.invalidcode << EOM;
           }
         }
@@ -348,7 +487,7 @@ namespace Gambit
       typedef std::chrono::milliseconds ms;
 
       // Print timing data
-      if(dependencyResolver.printTiming())
+      if(print_timing)
       {
         int rank = printer.getRank();
         // Convert time counts to doubles (had weird problem with long long ints on some systems)
@@ -363,8 +502,12 @@ namespace Gambit
     }
 
     if (debug) cout << "Total log-likelihood: " << lnlike << endl << endl;
-    logger() << "Total lnL: " << lnlike << EOM;
+    logger() << LogTags::core << LogTags::info << "Total lnL: " << lnlike << EOM;
     dependencyResolver.resetAll();
+    Utils::profiler().end_point();
+
+    // Share the functor runtime statistics with other processes from time to time, and adapt the order of the likelihoods to them.
+    if (dependencyResolver.syncRuntimeStatistics()) sortTargetVertices();
 
     // Disable the printer so that it doesn't try to output the min_valid_lnlike as a valid likelihood value. ScannerBit will re-enable it when needed again.
     // Disable only for the next print call
@@ -375,11 +518,66 @@ namespace Gambit
     return lnlike;
   }
 
+  /// Put the target vertices in the order given by the current runtime statistics (cheapest and most likely to invalidate the point first)
+  void Likelihood_Container::sortTargetVertices()
+  {
+    std::vector<DRes::VertexID> new_vertices;
+    std::vector<lnlike_type> new_types;
+    std::vector<str> new_tags;
+    std::vector<double> new_bounds;
+    for (DRes::VertexID vertex : dependencyResolver.getObsLikeOrder())
+    {
+      auto it = std::find(target_vertices.begin(), target_vertices.end(), vertex);
+      if (it == target_vertices.end()) continue;
+      size_t i = it - target_vertices.begin();
+      new_vertices.push_back(vertex);
+      new_types.push_back(return_types[i]);
+      new_tags.push_back(std::move(target_tags[i]));
+      new_bounds.push_back(upper_bounds[i]);
+    }
+    target_vertices = std::move(new_vertices);
+    return_types = std::move(new_types);
+    target_tags = std::move(new_tags);
+    upper_bounds = std::move(new_bounds);
+    setRemainingUpperBounds();
+  }
+
+  /// Work out the largest log-likelihood that can still be added after each target vertex
+  void Likelihood_Container::setRemainingUpperBounds()
+  {
+    remaining_upper_bounds.assign(upper_bounds.size(), 0.);
+    double sum = 0.;
+    for (size_t i = upper_bounds.size(); i-- > 0;)
+    {
+      remaining_upper_bounds[i] = sum;
+      sum += upper_bounds[i];
+    }
+  }
+
   /// Use this to modify the total likelihood function before passing it to the scanner
   double Likelihood_Container::purposeModifier(double lnlike)
   {
     return Utils::run_lnlike_modifier(lnlike, lnlike_modifier_name, lnlike_modifier_params);
   }
 
+  /// Estimate the cost of re-evaluating the likelihood when each parameter changes, from the runtimes of the functors depending on it
+  std::unordered_map<std::string, double> Likelihood_Container::getParameterCosts()
+  {
+    std::unordered_map<std::string, double> costs;
+    // Changing any parameter of a model means recomputing everything downstream of that model.
+    // Before any points have been computed, this simply counts the functors affected.
+    for (auto act_it = functorMap.begin(), act_end = functorMap.end(); act_it != act_end; act_it++)
+    {
+      double cost = dependencyResolver.getDownstreamRuntime(act_it->second);
+      auto paramkeys = act_it->second->getcontentsPtr()->getKeys();
+      for (auto par_it = paramkeys.begin(), par_end = paramkeys.end(); par_it != par_end; par_it++)
+      {
+        costs[act_it->first + "::" + *par_it] = cost;
+      }
+      logger() << LogTags::core << "Estimated cost of changing parameters of " << act_it->first << ": " << cost << " s" << EOM;
+    }
+    return costs;
+  }
+
 }
 
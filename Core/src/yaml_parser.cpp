@@ -105,6 +105,9 @@ namespace YAML
     if (node["printme"].IsDefined())
         rhs.printme = node["printme"].as<bool>();
 
+    if (node["lnlike_upper_bound"].IsDefined())
+        rhs.lnlike_upper_bound = node["lnlike_upper_bound"].as<double>();
+
     if (node["options"].IsDefined())
         rhs.options = Gambit::Options(node["options"]);
 
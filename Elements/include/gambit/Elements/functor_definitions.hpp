@@ -103,8 +103,19 @@ namespace Gambit
         backend_error().raise(LOCAL_INFO, ss.str());
       }
       boost::io::ios_flags_saver ifs(cout);        // Don't allow module functions to change the output precision of cout
-      int thread_num = omp_get_thread_num();
+      int thread_num = (iRunNested ? omp_get_thread_num() : 0); // Functors that cannot run nested only have one slot,
+                                                   // even if the dependency resolver runs them from another thread.
       init_memory();                               // Init memory if this is the first run through.
+      bool use_cache = (myResultCache != NULL and not myResultCacheKey.empty());
+      if (needs_recalculating[thread_num] and use_cache)  // Take the result from the result cache if it is there.
+      {
+        str data;
+        if (myResultCache->load(myResultCacheKey, data))
+        {
+          std::istringstream in(data);
+          if (Utils::cache_read(in, myValue[thread_num])) needs_recalculating[thread_num] = false;
+        }
+      }
       if (needs_recalculating[thread_num])         // Do the actual calculation if required.
       {
         logger().entering_module(myLogTag);
@@ -124,9 +135,22 @@ namespace Gambit
         }
         this->finishTiming(thread_num);            //Stop timing function evaluation
         logger().leaving_module();
+        if (use_cache and not point_exception_raised)  // Save the result for later runs.
+        {
+          std::ostringstream out;
+          Utils::cache_write(out, myValue[thread_num]);
+          myResultCache->store(myResultCacheKey, out.str());
+        }
       }
     }
 
+    /// Check whether the results of this functor can be kept in a result cache
+    template <typename TYPE>
+    bool module_functor<TYPE>::resultIsCacheable() const
+    {
+      return Utils::cache_serialiser<TYPE>::supported;
+    }
+
     /// Initialise the memory of this functor.
     template <typename TYPE>
     void module_functor<TYPE>::init_memory()
@@ -212,7 +236,8 @@ namespace Gambit
     : functor (func_name, func_capability, result_type, origin_name, claw),
       myFunction (inputFunction),
       myLogTag(-1),
-      inUse(false)
+      inUse(false),
+      myCallLock(NULL)
     {
       myVersion = origin_version;
       mySafeVersion = origin_safe_version;
@@ -252,9 +277,13 @@ namespace Gambit
     template <typename PTR_TYPE, typename TYPE, typename... ARGS>
     str backend_functor_common<PTR_TYPE, TYPE, ARGS...>::safe_version() const { return mySafeVersion; }
 
-    /// Set the inUse flag.
+    /// Set the inUse flag, and pick up the call lock of the backend (all backends are declared by now).
     template <typename PTR_TYPE, typename TYPE, typename... ARGS>
-    void backend_functor_common<PTR_TYPE, TYPE, ARGS...>::setInUse(bool flag) { inUse = flag; }
+    void backend_functor_common<PTR_TYPE, TYPE, ARGS...>::setInUse(bool flag)
+    {
+      inUse = flag;
+      myCallLock = backend_call_lock(this->myOrigin, this->myVersion);
+    }
 
     /// Hand out a safe pointer to this backend functor's inUse flag.
     template <typename PTR_TYPE, typename TYPE, typename... ARGS>
@@ -284,6 +313,8 @@ namespace Gambit
     template <typename TYPE, typename... ARGS>
     TYPE backend_functor<TYPE(*)(ARGS...), TYPE, ARGS...>::operator()(ARGS&&... args)
     {
+      Utils::profile_scope profile("backend", this->myOrigin, this->myName);
+      backend_call_guard guard(this->myCallLock);
       logger().entering_backend(this->myLogTag);
       TYPE tmp = this->myFunction(std::forward<ARGS>(args)...);
       logger().leaving_backend();
@@ -311,6 +342,8 @@ namespace Gambit
     template <typename... ARGS>
     void backend_functor<void(*)(ARGS...), void, ARGS...>::operator()(ARGS&&... args)
     {
+      Utils::profile_scope profile("backend", this->myOrigin, this->myName);
+      backend_call_guard guard(this->myCallLock);
       logger().entering_backend(this->myLogTag);
       this->myFunction(std::forward<ARGS>(args)...);
       logger().leaving_backend();
@@ -45,6 +45,7 @@
 #include <set>
 #include <vector>
 #include <chrono>
+#include <mutex>
 #include <sstream>
 #include <algorithm>
 #include <omp.h>
@@ -53,6 +54,8 @@
 #include "gambit/Utils/util_functions.hpp"
 #include "gambit/Utils/yaml_options.hpp"
 #include "gambit/Utils/model_parameters.hpp"
+#include "gambit/Utils/profiler.hpp"
+#include "gambit/Utils/result_cache.hpp"
 #include "gambit/Logs/logger.hpp"
 #include "gambit/Logs/logmaster.hpp" // Need full declaration of LogMaster class
 
@@ -112,9 +115,13 @@ namespace Gambit
       /// @{
       virtual double getRuntimeAverage();
       virtual double getInvalidationRate();
+      virtual void setRuntimeAverage(double);
+      virtual void setInvalidationRate(double);
       virtual void setFadeRate(double);
       virtual void notifyOfInvalidation(const str&);
       virtual void reset();
+      virtual void resetPrintFlags();
+      virtual bool resultAvailable();
       /// @}
 
       /// Reset-then-recalculate method
@@ -282,6 +289,13 @@ namespace Gambit
       /// Return a safe pointer to the options that this functor is supposed to run with (e.g. from the ini file).
       safe_ptr<Options> getOptions();
 
+      /// Work out the options to run with at each of the given number of fidelity levels, from the 'fidelity' list of
+      /// option overrides (lowest level first) in the ini-file options.  Levels beyond the list use the options as given.
+      void setFidelityLevels(int);
+
+      /// Switch to the options for the given fidelity level.
+      void setFidelity(int);
+
       /// Notify the functor about an instance of the options class that contains sub-capability information
       void notifyOfSubCaps(const Options&);
 
@@ -364,6 +378,9 @@ namespace Gambit
       /// Internal storage of function options, as a YAML node
       Options myOptions;
 
+      /// Options at each fidelity level (empty unless the options have a 'fidelity' entry)
+      std::vector<Options> myFidelityOptions;
+
       /// Internal storage of function sub-capabilities, as a YAML node
       Options mySubCaps;
 
@@ -420,15 +437,36 @@ namespace Gambit
       /// Getter for averaged runtime
       double getRuntimeAverage();
 
+      /// Setter for averaged runtime (e.g. from statistics saved by another process or run)
+      void setRuntimeAverage(double);
+
       /// Reset functor
       void reset();
 
+      /// Reset only the flags recording that the result has been printed, keeping the result itself
+      void resetPrintFlags();
+
+      /// Getter indicating if the functor holds a result computed since it was last reset
+      bool resultAvailable();
+
+      /// Keep the results of this functor in a persistent result cache (NULL to stop doing so)
+      void setResultCache(Utils::result_cache*);
+
+      /// Set the key of the result for the current point in the result cache
+      void setResultCacheKey(const str&);
+
+      /// Check whether the results of this functor can be kept in a result cache
+      virtual bool resultIsCacheable() const { return false; }
+
       /// Tell the functor that it invalidated the current point in model space, pass a message explaining why, and throw an exception.
       void notifyOfInvalidation(const str&);
 
       /// Getter for invalidation rate
       double getInvalidationRate();
 
+      /// Setter for invalidation rate (e.g. from statistics saved by another process or run)
+      void setInvalidationRate(double);
+
       /// Setter for the fade rate
       void setFadeRate(double);
 
@@ -626,6 +664,10 @@ namespace Gambit
       /// Needs recalculating or not?
       bool* needs_recalculating;
 
+      /// Persistent cache of results (NULL if not used), and the key of the result for the current point
+      Utils::result_cache* myResultCache;
+      str myResultCacheKey;
+
       /// Has result already been sent to the printer?
       bool* already_printed;
 
@@ -771,6 +813,9 @@ namespace Gambit
       /// Getter indicating if the wrapped function's result should to be printed
       virtual bool requiresPrinting() const;
 
+      /// Check whether the results of this functor can be kept in a result cache
+      virtual bool resultIsCacheable() const;
+
       /// Calculate method
       void calculate();
 
@@ -840,6 +885,40 @@ namespace Gambit
 
   // ======================== Backend Functors =====================================
 
+  // Each process evaluates one point at a time, through a single functor graph (module functors and their Pipes
+  // are per-process singletons).  Several threads may still call a backend while that point is computed: from
+  // module functions evaluated concurrently (parallel_functor_evaluation) and from OpenMP loops inside module
+  // functions.  The registry below records which backends may be used that way.
+
+  /// Declare that a backend is not reentrant, so that calls to its functions from different threads are serialised
+  int set_backend_not_reentrant(const str& backend, const str& version);
+
+  /// Check whether any version of a backend has been declared not reentrant
+  bool backend_not_reentrant(const str& backend);
+
+  /// Declare that the functions of a backend may be used by several module functions at once
+  void set_backend_threadsafe(const str& backend);
+
+  /// Check whether a backend may be used by several module functions at once.  This is the case only if it has been
+  /// declared threadsafe (from the 'threadsafe_backends' option of the dependency resolver), as no backend is unless
+  /// stated otherwise.  Backends declared not reentrant by their frontend never are.
+  bool backend_is_threadsafe(const str& backend);
+
+  /// Get the lock serialising calls to the functions of a backend (NULL if the backend is reentrant)
+  std::recursive_mutex* backend_call_lock(const str& backend, const str& version);
+
+  /// Holds a backend call lock (if any) for the duration of a backend call
+  class backend_call_guard
+  {
+    public:
+      backend_call_guard(std::recursive_mutex* lock) : myLock(lock) { if (myLock) myLock->lock(); }
+      ~backend_call_guard() { if (myLock) myLock->unlock(); }
+      backend_call_guard(const backend_call_guard&) = delete;
+      backend_call_guard& operator=(const backend_call_guard&) = delete;
+    private:
+      std::recursive_mutex* myLock;
+  };
+
   /// Backend functor class for functions with result type TYPE and argumentlist ARGS
   template <typename PTR_TYPE, typename TYPE, typename... ARGS>
   class backend_functor_common : public functor
@@ -865,6 +944,9 @@ namespace Gambit
       /// Flag indicating if this backend functor is actually in use in a given scan
       bool inUse;
 
+      /// Lock serialising calls to the functions of this backend (NULL if the backend is reentrant)
+      std::recursive_mutex* myCallLock;
+
     public:
 
       /// Constructor
@@ -946,6 +1028,8 @@ namespace Gambit
       template <typename... VARARGS>
       TYPE operator()(VARARGS&&... varargs)
       {
+        Utils::profile_scope profile("backend", this->myOrigin, this->myName);
+        backend_call_guard guard(this->myCallLock);
         logger().entering_backend(this->myLogTag);
         TYPE tmp = this->myFunction(std::forward<VARARGS>(varargs)...);
         logger().leaving_backend();
@@ -972,6 +1056,8 @@ namespace Gambit
       template <typename... VARARGS>
       void operator()(VARARGS&&... varargs)
       {
+        Utils::profile_scope profile("backend", this->myOrigin, this->myName);
+        backend_call_guard guard(this->myCallLock);
         logger().entering_backend(this->myLogTag);
         this->myFunction(std::forward<VARARGS>(varargs)...);
         logger().leaving_backend();
@@ -613,7 +613,7 @@
          Pipes::FUNCTION::Dep::CAT(MODEL,_parameters).safe_pointer();          \
         /* Use that to add the parameters provided by this MODEL to the map    \
         of safe pointers to model parameters. */                               \
-        for (std::map<str,double>::const_iterator it = model_safe_ptr->begin();\
+        for (ModelParameters::const_iterator it = model_safe_ptr->begin();     \
          it != model_safe_ptr->end(); ++it)                                    \
         {                                                                      \
           BOOST_PP_IIF(ALLOW_DUPLICATES_IN_PARAMS_MAP, ,                       \
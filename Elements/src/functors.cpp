@@ -39,6 +39,7 @@
 ///  *********************************************
 
 #include <chrono>
+#include <functional>
 
 #include "gambit/Elements/functors.hpp"
 #include "gambit/Elements/functor_definitions.hpp"
@@ -84,10 +85,14 @@ namespace Gambit
     /// @{
     double functor::getRuntimeAverage() { return 0; }
     double functor::getInvalidationRate() { return 0; }
+    void functor::setRuntimeAverage(double) {}
+    void functor::setInvalidationRate(double) {}
     void functor::setFadeRate(double) {}
     void functor::notifyOfInvalidation(const str&) {}
     void functor::reset() {}
     void functor::reset(int) {}
+    void functor::resetPrintFlags() {}
+    bool functor::resultAvailable() { return false; }
     /// @}
 
     /// Reset-then-recalculate method
@@ -390,6 +395,53 @@ namespace Gambit
       return safe_ptr<Options>(&myOptions);
     }
 
+    /// Work out the options to run with at each of the given number of fidelity levels, from the 'fidelity' list of
+    /// option overrides (lowest level first) in the ini-file options.  Levels beyond the list use the options as given.
+    void functor::setFidelityLevels(int levels)
+    {
+      myFidelityOptions.clear();
+      if (not myOptions.hasKey("fidelity")) return;
+      YAML::Node overrides = myOptions.getNode("fidelity");
+      if (not overrides.IsSequence() or int(overrides.size()) > levels)
+      {
+        std::ostringstream ss;
+        ss << "The fidelity option of " << myOrigin << "::" << myName << " must be a list of at most " << levels
+           << " sets of options (one per fidelity level, lowest first).";
+        utils_error().raise(LOCAL_INFO, ss.str());
+      }
+
+      // Merge the overrides into a copy of the full options, recursing into sub-options.
+      std::function<void(YAML::Node, const YAML::Node&)> merge = [&](YAML::Node to, const YAML::Node& from)
+      {
+        for (auto it = from.begin(); it != from.end(); ++it)
+        {
+          const str key = it->first.as<str>();
+          if (it->second.IsMap() and to[key] and to[key].IsMap()) merge(to[key], it->second);
+          else to[key] = YAML::Clone(it->second);
+        }
+      };
+      for (int level = 0; level < levels; ++level)
+      {
+        YAML::Node node = YAML::Clone(myOptions.getNode());
+        node.remove("fidelity");
+        if (level < int(overrides.size()))
+        {
+          if (not overrides[level].IsMap() and not overrides[level].IsNull())
+          {
+            utils_error().raise(LOCAL_INFO, "Entry " + std::to_string(level) + " of the fidelity option of " + myOrigin + "::" + myName + " is not a set of options.");
+          }
+          if (overrides[level].IsMap()) merge(node, overrides[level]);
+        }
+        myFidelityOptions.push_back(Options(node));
+      }
+    }
+
+    /// Switch to the options for the given fidelity level.
+    void functor::setFidelity(int level)
+    {
+      if (not myFidelityOptions.empty()) myOptions.rebind(myFidelityOptions.at(level));
+    }
+
     /// Notify the functor about an instance of the options class that contains sub-capability information
     void functor::notifyOfSubCaps(const Options& subcaps)
     {
@@ -661,6 +713,7 @@ namespace Gambit
       fadeRate                 (FUNCTORS_FADE_RATE),              // can be set individually for each functor
       pInvalidation            (FUNCTORS_BASE_INVALIDATION_RATE),
       needs_recalculating      (NULL),
+      myResultCache            (NULL),
       already_printed          (NULL),
       already_printed_timing   (NULL),
       iCanManageLoops          (false),
@@ -709,6 +762,12 @@ namespace Gambit
       return runtime_average;
     }
 
+    /// Setter for averaged runtime
+    void module_functor_common::setRuntimeAverage(double new_runtime)
+    {
+      runtime_average = new_runtime;
+    }
+
     /// Setter for indicating if the timing data for this function's execution should be printed
     void module_functor_common::setTimingPrintRequirement(bool flag)
     {
@@ -733,6 +792,33 @@ namespace Gambit
       point_exception_raised = false;
     }
 
+    /// Reset only the flags recording that the result has been printed, keeping the result itself
+    void module_functor_common::resetPrintFlags()
+    {
+      init_memory();
+      int n = (iRunNested ? globlMaxThreads : 1);
+      std::fill(already_printed, already_printed+n, false);
+      std::fill(already_printed_timing, already_printed_timing+n, false);
+    }
+
+    /// Getter indicating if the functor holds a result computed since it was last reset
+    bool module_functor_common::resultAvailable()
+    {
+      return needs_recalculating != NULL and not needs_recalculating[0];
+    }
+
+    /// Keep the results of this functor in a persistent result cache (NULL to stop doing so)
+    void module_functor_common::setResultCache(Utils::result_cache* cache)
+    {
+      myResultCache = cache;
+    }
+
+    /// Set the key of the result for the current point in the result cache
+    void module_functor_common::setResultCacheKey(const str& key)
+    {
+      myResultCacheKey = key;
+    }
+
     /// Reset functor for one thread only
     void module_functor_common::reset(int thread_num)
     {
@@ -783,6 +869,12 @@ namespace Gambit
       return pInvalidation;
     }
 
+    /// Setter for invalidation rate
+    void module_functor_common::setInvalidationRate(double new_rate)
+    {
+      pInvalidation = new_rate;
+    }
+
     /// Setter for the fade rate
     void module_functor_common::setFadeRate(double new_rate)
     {
@@ -1697,6 +1789,7 @@ namespace Gambit
     /// Do pre-calculate timing things
     void module_functor_common::startTiming(int thread_num)
     {
+      if (Utils::profiler().active()) Utils::profiler().begin_event("module", myOrigin, myName);
       start[thread_num] = std::chrono::system_clock::now();
     }
 
@@ -1704,6 +1797,7 @@ namespace Gambit
     void module_functor_common::finishTiming(int thread_num)
     {
       end[thread_num] = std::chrono::system_clock::now();
+      if (Utils::profiler().active()) Utils::profiler().end_event();
       std::chrono::duration<double> runtime = end[thread_num] - start[thread_num];
       #pragma omp critical(module_functor_common_finishTiming)
       {
@@ -1749,7 +1843,7 @@ namespace Gambit
         backend_error().raise(LOCAL_INFO, ss.str());
       }
       boost::io::ios_flags_saver ifs(cout);        // Don't allow module functions to change the output precision of cout
-      int thread_num = omp_get_thread_num();
+      int thread_num = (iRunNested ? omp_get_thread_num() : 0); // Only nested functors have one slot per thread
       fill_activeModelFlags();                     // If activeModels hasn't been populated yet, make sure it is.
       init_memory();                               // Init memory if this is the first run through.
       if (needs_recalculating[thread_num])
@@ -1784,6 +1878,62 @@ namespace Gambit
       void module_functor<void>::print(Printers::BasePrinter*, const int) {}
     #endif
 
+    /// @{ Backend call locks
+
+    /// Registry of the call locks of non-reentrant backends, keyed by backend name + version
+    std::map<str, std::recursive_mutex>& backend_call_locks()
+    {
+      static std::map<str, std::recursive_mutex> locks;
+      return locks;
+    }
+
+    /// Names of the backends with at least one version declared not reentrant, and of those declared threadsafe
+    std::set<str>& not_reentrant_backends()
+    {
+      static std::set<str> names;
+      return names;
+    }
+    std::set<str>& threadsafe_backends()
+    {
+      static std::set<str> names;
+      return names;
+    }
+
+    /// Declare that a backend is not reentrant, so that calls to its functions from different threads are serialised
+    int set_backend_not_reentrant(const str& backend, const str& version)
+    {
+      backend_call_locks()[backend + version];
+      not_reentrant_backends().insert(backend);
+      return 0;
+    }
+
+    /// Check whether any version of a backend has been declared not reentrant
+    bool backend_not_reentrant(const str& backend)
+    {
+      return not_reentrant_backends().count(backend) > 0;
+    }
+
+    /// Declare that the functions of a backend may be used by several module functions at once
+    void set_backend_threadsafe(const str& backend)
+    {
+      threadsafe_backends().insert(backend);
+    }
+
+    /// Check whether a backend may be used by several module functions at once
+    bool backend_is_threadsafe(const str& backend)
+    {
+      return threadsafe_backends().count(backend) > 0 and not backend_not_reentrant(backend);
+    }
+
+    /// Get the lock serialising calls to the functions of a backend (NULL if the backend is reentrant)
+    std::recursive_mutex* backend_call_lock(const str& backend, const str& version)
+    {
+      auto it = backend_call_locks().find(backend + version);
+      return (it == backend_call_locks().end() ? NULL : &(it->second));
+    }
+
+    /// @}
+
     /// @{ Model functor class method definitions
 
     /// Constructor
@@ -1813,7 +1963,7 @@ namespace Gambit
     /// Function for handing over parameter identities to another model_functor
     void model_functor::donateParameters(model_functor &receiver)
     {
-      for(std::map<std::string,double>::const_iterator it = myValue->begin();
+      for(ModelParameters::const_iterator it = myValue->begin();
           it != myValue->end();
           it++)
       {
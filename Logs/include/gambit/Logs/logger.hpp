@@ -68,6 +68,12 @@ namespace Gambit
      EXPORT_SYMBOLS LogMaster& operator<<(LogMaster&, const manip2);
      EXPORT_SYMBOLS LogMaster& operator<<(LogMaster&, const manip3);
 
+     // Check whether the message being streamed will be ignored (i.e. the logs are
+     // silenced or an ignored tag has already been streamed), so that the formatting
+     // of its remaining contents can be skipped.  Stream the tags of a message first
+     // to get the most out of this.
+     EXPORT_SYMBOLS bool muted(LogMaster&);
+
      // Stream function to convert everything else to strings before
      // feeding into LogMaster (this way no-one needs to have the full
      // declaration of the LogMaster class; I think the overhead
@@ -78,6 +84,7 @@ namespace Gambit
      LogMaster& operator << (LogMaster& logobj, const TYPE& input)
      {
        using ::Gambit::operator<<; // Unhide operator overloads in Gambit scope
+       if (muted(logobj)) return logobj;
        std::stringstream ss;
        ss << input;
        logobj << ss.str();
@@ -88,6 +95,7 @@ namespace Gambit
      LogMaster& operator << (LogMaster& logobj, TYPE& input)
      {
        using ::Gambit::operator<<; // Unhide operator overloads in Gambit scope
+       if (muted(logobj)) return logobj;
        std::stringstream ss;
        ss << input;
        logobj << ss.str();
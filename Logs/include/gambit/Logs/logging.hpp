@@ -29,6 +29,7 @@
 #include <deque>
 #include <fstream>
 #include <chrono> 
+#include <atomic>
 #include <omp.h>
 
 // Gambit
@@ -76,6 +77,8 @@ namespace Gambit
         std::string message;
         std::set<int> tags;
         Utils::time_point received_at;
+        /// Default constructor (for preallocated queue slots)
+        Message() {}
         /// Constructor
         Message(const std::string& msgIN, 
                 const std::set<int>& tagsIN)
@@ -85,6 +88,34 @@ namespace Gambit
         {}
     };
 
+    /// Bounded lock-free queue of messages, filled by one thread and emptied by another.  Each OS thread gets its own
+    /// queue (see LogMaster::thread_queue), so that there is never more than one producer.
+    class MessageQueue
+    {
+      public:
+        /// Constructor
+        MessageQueue();
+
+        /// Set the number of messages the queue can hold (not thread safe; call before use)
+        void resize(size_t);
+
+        /// Add a message to the back of the queue; returns false without moving it if the queue is full
+        bool push(Message&);
+
+        /// Move the message at the front of the queue into the argument; returns false if the queue is empty
+        bool pop(Message&);
+
+      private:
+        std::vector<Message> slots;
+        /// Counts of messages pushed and popped, kept on separate cache lines as they are written by different threads.
+        /// Padded explicitly rather than with alignas, as over-aligned types cannot be allocated with new before C++17.
+        char pad0[64];
+        std::atomic<size_t> pushed;
+        char pad1[64 - sizeof(std::atomic<size_t>)];
+        std::atomic<size_t> popped;
+        char pad2[64 - sizeof(std::atomic<size_t>)];
+    };
+
     /// structure for storing log messages and metadata after tags are sorted
     struct SortedMessage
     {
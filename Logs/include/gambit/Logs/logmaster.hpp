@@ -29,6 +29,11 @@
 #include <deque>
 #include <fstream>
 #include <chrono>
+#include <thread>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
 #include <omp.h>
 
 // Gambit
@@ -42,6 +47,7 @@ namespace Gambit
   {
     /// Forward declarations
     struct Message;
+    class MessageQueue;
     class BaseLogger;
 
     /// Logging "controller" object
@@ -113,6 +119,11 @@ namespace Gambit
         void send(const std::ostringstream&,LogTag,LogTag,LogTag,LogTag,LogTag);
         //...add more as needed
 
+        /// Check whether the message currently being streamed by this thread will be ignored.
+        /// This is the case once the logs are silenced or any ignored tag has been streamed,
+        /// so it is cheapest to stream the tags of a message before its contents.
+        bool muted();
+
         /// Internal version of main logging function
         void send(const std::string&, std::set<LogTag>&);
         void send(const std::string&, std::set<int>&);
@@ -137,12 +148,37 @@ namespace Gambit
         /// Choose whether "Debug" tagged log messages will be ignored (i.e. not logged)
         void set_log_debug_messages(bool flag) {log_debug_messages=flag;}
 
+        /// Choose further tags (by name) for which tagged log messages will be ignored
+        void set_ignored_tags(const std::set<std::string>& tags) {ignored_tag_names=tags;}
+
+        /// Choose whether messages are handed to a separate writer thread through per-thread queues, rather than written directly
+        void set_asynchronous(bool flag) {asynchronous=flag;}
+
+        /// Choose how many messages each thread's queue can hold in asynchronous mode
+        void set_queue_length(int length) {queue_length=length;}
+
+        /// Choose whether a thread waits for space when its queue is full (otherwise the message is dropped)
+        void set_block_when_full(bool flag) {block_when_full=flag;}
+
         /// @}
 
       private:
         /// Empty the backlog buffer to the 'send' function
         void empty_backlog();
 
+        /// Start the writer thread for asynchronous mode
+        void start_writer();
+
+        /// Deliver all remaining queued messages and stop the writer thread
+        void stop_writer();
+
+        /// Main loop of the writer thread
+        void writer_loop();
+
+        /// Queue of the calling OS thread, created on first use.  Queues are not keyed on the OpenMP thread number, as
+        /// threads of different (e.g. nested) parallel regions can share the same number.
+        MessageQueue& thread_queue();
+
         /// Map to identify loggers
         std::map<std::set<int>,BaseLogger*> loggers;
 
@@ -161,6 +197,18 @@ namespace Gambit
         /// Flag to ignore Debug tagged messages
         bool log_debug_messages;
 
+        /// Names of additional tags to add to the global ignore set on initialisation
+        std::set<std::string> ignored_tag_names;
+
+        /// Flag to deliver messages through a separate writer thread
+        bool asynchronous;
+
+        /// Number of messages each thread's queue can hold in asynchronous mode
+        int queue_length;
+
+        /// Flag to wait for space in a full queue rather than dropping the message
+        bool block_when_full;
+
         /// MPI variables
         int MPIrank;
         int MPIsize;
@@ -178,11 +226,40 @@ namespace Gambit
         std::ostringstream* stream;
         std::set<int>* streamtags;
 
+        /// Flags indicating that the message being streamed will be ignored, so need not be formatted
+        bool* streammuted;
+
         /// Messages sent before logger objects are created will be buffered
         /// Same for messages sent while inside omp parallel blocks
         std::deque<Message>* backlog;
 
         /// @}
+
+        /// @{ Asynchronous mode
+
+        /// Queues of messages waiting for the writer thread (one per OS thread that has logged), and the lock for adding to them
+        std::vector<std::unique_ptr<MessageQueue>> queues;
+        std::mutex queues_mutex;
+
+        /// Identifies the current set of queues, so that threads do not keep using queues from an earlier writer thread
+        unsigned long queue_generation;
+
+        /// Wakes threads waiting for space in a full queue, and the writer thread when a queue is full
+        std::mutex wait_mutex;
+        std::condition_variable space_available;
+        std::condition_variable writer_wakeup;
+
+        /// Thread that empties the queues into the loggers
+        std::thread writer;
+
+        /// Flags indicating that the writer thread is running, and that it should stop once the queues are empty
+        std::atomic<bool> writer_running;
+        std::atomic<bool> writer_stop;
+
+        /// Number of messages dropped because a queue was full
+        std::atomic<long long> dropped;
+
+        /// @}
     };
 
   } //end namespace Logging
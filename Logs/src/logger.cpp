@@ -89,6 +89,12 @@ namespace Gambit
      }
 
      /// @}
+
+     /// Check whether the message being streamed will be ignored
+     bool muted(LogMaster& logobj)
+     {
+        return logobj.muted();
+     }
   }
  
   // Log retriever function
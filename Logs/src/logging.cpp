@@ -251,6 +251,37 @@ namespace Gambit
        } //end tag sorting
     } // end SortedMessage constructor
 
+    /// %%%% Message queue %%%
+
+    /// Constructor
+    MessageQueue::MessageQueue() : pushed(0), popped(0) {}
+
+    /// Set the number of messages the queue can hold
+    void MessageQueue::resize(size_t n)
+    {
+      slots.resize(n);
+    }
+
+    /// Add a message to the back of the queue; returns false if the queue is full
+    bool MessageQueue::push(Message& mail)
+    {
+      size_t n = pushed.load(std::memory_order_relaxed);
+      if (n - popped.load(std::memory_order_acquire) >= slots.size()) return false;
+      std::swap(slots[n % slots.size()], mail);
+      pushed.store(n + 1, std::memory_order_release);
+      return true;
+    }
+
+    /// Move the message at the front of the queue into the argument; returns false if the queue is empty
+    bool MessageQueue::pop(Message& mail)
+    {
+      size_t n = popped.load(std::memory_order_relaxed);
+      if (n == pushed.load(std::memory_order_acquire)) return false;
+      std::swap(slots[n % slots.size()], mail);
+      popped.store(n + 1, std::memory_order_release);
+      return true;
+    }
+
     /// %%%% Logger classes %%%
 
     // Apparantly this cannot be virtual, so provide an implementation for it
@@ -27,6 +27,8 @@
 #include <algorithm>
 #include <limits>
 #include <chrono>
+#include <mutex>
+#include <condition_variable>
 #include <omp.h>
 
 // Gambit
@@ -57,6 +59,9 @@ namespace Gambit
       , silenced       (false)
       , separate_file_per_process(true)
       , log_debug_messages(false)
+      , asynchronous   (false)
+      , queue_length   (10000)
+      , block_when_full(false)
       , MPIrank        (0)
       , MPIsize        (1)
       , globlMaxThreads(omp_get_max_threads())
@@ -64,7 +69,13 @@ namespace Gambit
       , current_backend(NULL)
       , stream         (NULL)
       , streamtags     (NULL)
+      , streammuted    (NULL)
       , backlog        (NULL)
+      , queues         ()
+      , queue_generation(0)
+      , writer_running (false)
+      , writer_stop    (false)
+      , dropped        (0)
     {
       // Note! MPIrank and MPIsize will not be correct until initialisation occurs!
     }
@@ -77,6 +88,9 @@ namespace Gambit
       , silenced       (false)
       , separate_file_per_process(true)
       , log_debug_messages(false)
+      , asynchronous   (false)
+      , queue_length   (10000)
+      , block_when_full(false)
       , MPIrank        (0)
       , MPIsize        (1)
       , globlMaxThreads(omp_get_max_threads())
@@ -84,7 +98,13 @@ namespace Gambit
       , current_backend(NULL)
       , stream         (NULL)
       , streamtags     (NULL)
+      , streammuted    (NULL)
       , backlog        (NULL)
+      , queues         ()
+      , queue_generation(0)
+      , writer_running (false)
+      , writer_stop    (false)
+      , dropped        (0)
     {
       // Note! MPIrank and MPIsize will not be correct until initialisation occurs!
     }
@@ -108,6 +128,14 @@ namespace Gambit
           if(streamtags==NULL) streamtags = new std::set<int>[n];
         }
       }
+      if(streammuted==NULL)
+      {
+        #pragma omp critical(logmaster_common_init_memory_streammuted)
+        {
+          if(streammuted==NULL) streammuted = new bool[n];
+          std::fill(streammuted, streammuted+n, false);
+        }
+      }
       if(backlog==NULL)
       {
         #pragma omp critical(logmaster_common_init_memory_backlog)
@@ -182,6 +210,9 @@ namespace Gambit
        //    }
        // }
 
+       // Deliver anything still queued for the writer thread; from here on messages go to the backlog instead.
+       stop_writer();
+
        if(not silenced)
        {
          // Check if there is anything in the output stream that has not been sent, and send it if there is
@@ -217,6 +248,7 @@ namespace Gambit
        // Delete the thread variables
        if (stream != NULL)         delete [] stream;
        if (streamtags != NULL)     delete [] streamtags;
+       if (streammuted != NULL)    delete [] streammuted;
        if (backlog != NULL)        delete [] backlog;
        if (current_module !=NULL)  delete [] current_module;
        if (current_backend !=NULL) delete [] current_backend;
@@ -259,6 +291,28 @@ namespace Gambit
           logmsg << "false; log messages tagged as 'Debug' will NOT be logged";
        }
 
+       // Add any other tags requested to the global ignore list
+       for(std::set<std::string>::iterator stag = ignored_tag_names.begin(); stag != ignored_tag_names.end(); ++stag)
+       {
+          int tag = str2tag(*stag);
+          if(tag==-1)
+          {
+            std::ostringstream errormsg;
+            errormsg << "The LogTag \"" << *stag << "\" in the list of tags to ignore is not recognised by the logger system." << endl
+                     << "Please remove it from the 'ignore' entry of the Logger section of your yaml file." << endl;
+            logging_error().raise(LOCAL_INFO,errormsg.str());
+          }
+          ignore.insert(tag);
+          logmsg << endl << "  log messages tagged as '" << *stag << "' will NOT be logged";
+       }
+
+       if(asynchronous)
+       {
+          logmsg << endl << "  asynchronous = true; log messages will be written by a separate thread, with up to " << queue_length
+                 << " messages queued per thread. When a queue is full, new messages will be "
+                 << (block_when_full ? "held until there is space" : "dropped");
+       }
+
        if (MPIrank == 0) std::cout << logmsg.str() << std::endl;
        *this << LogTag::logs << LogTag::debug << logmsg.str() << EOM;
 
@@ -327,6 +381,8 @@ namespace Gambit
        // Set logger objects ready for use and dump any buffered messages
        loggers_readyQ = true;
        empty_backlog();
+       // Hand all further messages to the writer thread if requested
+       if(asynchronous) start_writer();
     }
 
     // Overload for initialise to allow input of logging instructions via maps
@@ -394,7 +450,7 @@ namespace Gambit
 
        for(int i=0; i<globlMaxThreads; i++)
        {
-         for(size_t j=0; j<backlog[i].size(); j++)
+         while(not backlog[i].empty())
          {
             finalsend(backlog[i].front());
             backlog[i].pop_front();
@@ -402,6 +458,97 @@ namespace Gambit
        }
     }
 
+    // Start the writer thread for asynchronous mode
+    void LogMaster::start_writer()
+    {
+       if(queue_length < 1) logging_error().raise(LOCAL_INFO,"The Logger option queue_length must be at least 1.");
+       static std::atomic<unsigned long> generations(0);
+       queue_generation = ++generations;
+       writer_stop = false;
+       writer = std::thread(&LogMaster::writer_loop, this);
+       writer_running = true;
+    }
+
+    // Deliver all remaining queued messages and stop the writer thread
+    void LogMaster::stop_writer()
+    {
+       if(not writer_running) return;
+       writer_running = false;
+       writer_stop = true;
+       writer.join();
+       // Pick up anything queued while the writer was finishing, and release any threads still waiting for space
+       Message mail;
+       {
+         std::lock_guard<std::mutex> lock(queues_mutex);
+         for(auto& queue : queues) while(queue->pop(mail)) finalsend(mail);
+       }
+       space_available.notify_all();
+       if(dropped > 0)
+       {
+         std::ostringstream msg;
+         msg << dropped << " log messages were dropped because the logger queues were full. Increase the Logger option "
+             << "queue_length or set block_when_full to keep them.";
+         std::set<int> tags;
+         tags.insert(def);
+         tags.insert(logs);
+         tags.insert(warn);
+         finalsend(Message(msg.str(),tags));
+       }
+    }
+
+    // Main loop of the writer thread: deliver queued messages until told to stop and there are none left
+    void LogMaster::writer_loop()
+    {
+       Message mail;
+       std::vector<MessageQueue*> current;
+       while(true)
+       {
+         bool stopping = writer_stop;
+         bool delivered = false;
+         // Queues are only added while the writer runs, so the list can be copied and then emptied without the lock.
+         {
+           std::lock_guard<std::mutex> lock(queues_mutex);
+           current.clear();
+           for(auto& queue : queues) current.push_back(queue.get());
+         }
+         for(MessageQueue* queue : current)
+         {
+           while(queue->pop(mail))
+           {
+             finalsend(mail);
+             delivered = true;
+           }
+         }
+         if(delivered)
+         {
+           space_available.notify_all();
+         }
+         else
+         {
+           if(stopping) break;
+           // Sleep until a thread finds its queue full, or for at most 1 ms.
+           std::unique_lock<std::mutex> lock(wait_mutex);
+           writer_wakeup.wait_for(lock, std::chrono::milliseconds(1));
+         }
+       }
+    }
+
+    // Queue of the calling OS thread, created on first use
+    MessageQueue& LogMaster::thread_queue()
+    {
+       thread_local unsigned long generation = 0;
+       thread_local MessageQueue* queue = NULL;
+       if(generation != queue_generation)
+       {
+         std::lock_guard<std::mutex> lock(queues_mutex);
+         queues.emplace_back(new MessageQueue);
+         queues.back()->resize(queue_length);
+         queue = queues.back().get();
+         generation = queue_generation;
+       }
+       return *queue;
+    }
+
     /// Main logging function (user-friendly overloaded version)
     // Need a bunch of overloads of this to deal with
     void LogMaster::send(const std::string& message)
@@ -558,8 +705,26 @@ namespace Gambit
          tags.insert(current_backend[i]);
        }
 
+       // If there is a writer thread, queue the message for it (this is safe inside omp parallel blocks too)
+       if(writer_running)
+       {
+         Message mail(message,tags); //time stamp automatically added NOW
+         MessageQueue& queue = thread_queue();
+         bool queued = queue.push(mail);
+         if(not queued and block_when_full)
+         {
+           // Wake the writer and sleep until it has made space.  The timeout covers a wakeup sent just before waiting.
+           std::unique_lock<std::mutex> lock(wait_mutex);
+           while(not (queued = queue.push(mail)) and writer_running)
+           {
+             writer_wakeup.notify_one();
+             space_available.wait_for(lock, std::chrono::milliseconds(10));
+           }
+         }
+         if(not queued) dropped++;
+       }
        // If the loggers have not yet been initialised, buffer the message
-       if(omp_get_level()!=0 or not loggers_readyQ)
+       else if(omp_get_level()!=0 or not loggers_readyQ)
        {
          backlog[i].emplace_back(message,tags); //time stamp automatically added NOW
        }
@@ -634,8 +799,7 @@ namespace Gambit
     {
        init_memory();
        current_backend[omp_get_thread_num()] = i;
-       *this<<"Setting current_backend="<<i;
-       *this<<logs<<debug<<EOM;
+       *this<<logs<<debug<<"Setting current_backend="<<i<<EOM;
     }
     void LogMaster::leaving_backend()
     {
@@ -644,15 +808,24 @@ namespace Gambit
        cb_test = current_backend[omp_get_thread_num()];
        if (cb_test == -1) return;
        current_backend[omp_get_thread_num()] = -1;
-       *this<<"Restoring current_backend="<<-1;
-       *this<<logs<<debug<<EOM;
+       *this<<logs<<debug<<"Restoring current_backend="<<-1<<EOM;
+    }
+
+    /// Check whether the message currently being streamed by this thread will be ignored
+    bool LogMaster::muted()
+    {
+       init_memory();
+       return silenced or streammuted[omp_get_thread_num()];
     }
 
     /// Handle LogTag input
     void LogMaster::input(const LogTag& tag)
     {
        init_memory();
-       streamtags[omp_get_thread_num()].insert(tag);
+       int i = omp_get_thread_num();
+       streamtags[i].insert(tag);
+       // Stop collecting the message if finalsend is going to ignore it anyway
+       if(ignore.find(tag) != ignore.end()) streammuted[i] = true;
     }
 
     /// Handle end of message character
@@ -661,35 +834,36 @@ namespace Gambit
        init_memory();
        size_t i = omp_get_thread_num();
        // Collect the stream and tags, then send the message
-       send(stream[i].str(), streamtags[i]);
+       if(not muted()) send(stream[i].str(), streamtags[i]);
        // Clear stream and tags for next message;
        stream[i].str(std::string()); //TODO: check that this works properly on all compilers...
        streamtags[i].clear();
+       streammuted[i] = false;
     }
 
     /// Handle strings
     void LogMaster::input(const std::string& in)
     {
-       init_memory();
+       if(muted()) return;
        stream[omp_get_thread_num()] << in;
     }
 
     /// Handle various stream manipulators
     void LogMaster::input(const manip1 fp)
     {
-       init_memory();
+       if(muted()) return;
        stream[omp_get_thread_num()] << fp;
     }
 
     void LogMaster::input(const manip2 fp)
     {
-       init_memory();
+       if(muted()) return;
        stream[omp_get_thread_num()] << fp;
     }
 
     void LogMaster::input(const manip3 fp)
     {
-       init_memory();
+       if(muted()) return;
        stream[omp_get_thread_num()] << fp;
     }
 
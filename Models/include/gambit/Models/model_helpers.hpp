@@ -20,6 +20,7 @@
 #define __model_helpers_hpp__
 
 #include <vector>
+#include <cstring>
 #include "gambit/Utils/model_parameters.hpp" 
 
 namespace Gambit
@@ -37,6 +38,32 @@ namespace Gambit
        }       
     }
 
+    // Record of the parameter values last translated by an interpret-as-X function,
+    // used to skip the translation when they have not changed since the previous point.
+    class translation_cache
+    {
+      public:
+        // Check if the values in myP are bitwise identical to those of the last translation
+        bool matches(const ModelParameters &myP) const
+        {
+          const std::vector<double>& v = myP.getValueArray();
+          return valid and v.size() == values.size() and
+           (v.empty() or std::memcmp(v.data(), values.data(), v.size()*sizeof(double)) == 0);
+        }
+        // Forget the last translation (e.g. before running one that might throw)
+        void invalidate() { valid = false; }
+        // Remember the values in myP as those of the last successful translation
+        void store(const ModelParameters &myP)
+        {
+          const std::vector<double>& v = myP.getValueArray();
+          values.assign(v.begin(), v.end());
+          valid = true;
+        }
+      private:
+        std::vector<double> values;
+        bool valid = false;
+    };
+
   }
   
 }
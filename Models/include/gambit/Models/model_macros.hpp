@@ -25,6 +25,7 @@
 
 #include "gambit/Models/orphan.hpp"
 #include "gambit/Models/claw_singleton.hpp"
+#include "gambit/Models/model_helpers.hpp"
 #include "gambit/Utils/util_macros.hpp"
 #include "gambit/Utils/boost_fallbacks.hpp"
 #include "gambit/Elements/ini_functions.hpp"
@@ -396,9 +397,19 @@
           using namespace Pipes::CAT(MODEL_X,_parameters);                     \
           const ModelParameters& model_params = *Dep::CAT(MODEL,_parameters);  \
                                                                                \
+          /* If the translation depends only on MODEL's parameters, skip it    \
+             when they are unchanged since the last point. The result is kept  \
+             in model_x_params, so whole chains of translations get skipped. */\
+          static const bool cacheable = (Functown::CAT(MODEL_X,_parameters).   \
+           dependencies().size() == 1);                                        \
+          static translation_cache cache;                                      \
+          if (cacheable and cache.matches(model_params)) return;               \
+          cache.invalidate();                                                  \
+                                                                               \
           /* Run user-supplied code (which must take result as an
              argument, and set the parameters it contains as desired) */       \
           FUNC (model_params,model_x_params);                                  \
+          if (cacheable) cache.store(model_params);                            \
         }                                                                      \
                                                                                \
       }                                                                        \
@@ -5,6 +5,8 @@
 ///  Simple overlay of std::map that makes [] act
 ///  like .at(), so that Param map in module
 ///  functors can give a more customised error.
+///  Also provides integer handles for repeated
+///  access without string lookups.
 ///
 ///  *********************************************
 ///
@@ -27,6 +29,7 @@
 #include "gambit/Utils/standalone_error_handlers.hpp"
 
 #include <map>
+#include <vector>
 #include <string>
 #include <stdexcept>
 
@@ -40,6 +43,26 @@ namespace Gambit
     class safe_param_map : public std::map<std::string,T>
     {
       public:
+
+        /// Integer handle to an entry, for access without a map lookup
+        typedef size_t handle;
+
+        /// Get the handle of an entry.  Handles stay valid for the lifetime of the map, so they should
+        /// be obtained once per functor (e.g. into a static variable) and reused at every point.  The map
+        /// must hold pointers to double (as the Param map does).
+        handle index(const std::string& key)
+        {
+          auto it = handles.find(key);
+          if (it != handles.end()) return it->second;
+          // Dereference through the safe pointer once, so that missing parameters give the usual error.
+          values.push_back(&*(*this)[key]);
+          handles[key] = values.size() - 1;
+          return values.size() - 1;
+        }
+
+        /// Get the value of an entry by handle (see index), with no hashing, virtual call or check
+        const double& operator[](handle h) const { return *values[h]; }
+
         T operator[](std::string key) const
         {
           try
@@ -58,6 +81,14 @@ namespace Gambit
           T temp2(this->at(key)); // Will only get here if someone has turned model errors into warnings.  If so, they get what they deserve.
           return temp2;
         }
+
+      private:
+
+        /// Addresses of the values that handles have been given out for, in order of handle
+        std::vector<const double*> values;
+
+        /// Handles given out so far
+        std::map<std::string,handle> handles;
     };
 
   }
@@ -0,0 +1,111 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  ObjectivesBit standalone main program.
+///  Evaluates the 2D test functions at a few
+///  points, checking that the parameter handles
+///  used by the module functions (see
+///  Models::safe_param_map::index) follow the
+///  model parameters from point to point.
+///  Exits with a non-zero code on any mismatch.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+// Always required in any standalone module main file
+#include "gambit/Elements/standalone_module.hpp"
+#include "gambit/ObjectivesBit/ObjectivesBit_rollcall.hpp"
+
+// Only needed here
+#include "gambit/Utils/test_functions.hpp"
+
+using namespace ObjectivesBit::Functown;     // Functors wrapping the module's actual module functions
+
+
+int main()
+{
+
+  int failures = 0;
+
+  try
+  {
+
+    std::cout << std::endl << "Starting ObjectivesBit standalone" << std::endl;
+    std::cout << "----------" << std::endl;
+
+    //Initialise logging (just comment out if you want no logfiles)
+    initialise_standalone_logs("runs/ObjectivesBit_standalone/logs/");
+
+    // Retrieve a raw pointer to the parameter set of the model to be scanned, for manually setting parameter values
+    ModelParameters* trivial_2d_primary_parameters = Models::trivial_2d::Functown::primary_parameters.getcontentsPtr();
+
+    // Notify the module functions of the model being scanned, and resolve their dependencies on its parameters
+    himmelblau.notifyOfModel("trivial_2d");
+    rosenbrock.notifyOfModel("trivial_2d");
+    himmelblau.resolveDependency(&Models::trivial_2d::Functown::primary_parameters);
+    rosenbrock.resolveDependency(&Models::trivial_2d::Functown::primary_parameters);
+
+    // Take handles to the parameters once, as a module function would, and a reference to the name-value map
+    Models::safe_param_map<safe_ptr<const double> >& Param = ObjectivesBit::Pipes::himmelblau::Param;
+    const auto x1 = Param.index("x1");
+    const auto x2 = Param.index("x2");
+    const std::map<std::string, double>& values = trivial_2d_primary_parameters->getValues();
+
+    // Loop over some points in the model parameter space
+    const double points[][2] = {{0., 0.}, {3., 2.}, {-2.805118, 3.131312}, {1., 1.}, {0.5, -4.}};
+    for (const auto& point : points)
+    {
+      // Give the model parameters
+      trivial_2d_primary_parameters->setValue("x1", point[0]);
+      trivial_2d_primary_parameters->setValue("x2", point[1]);
+
+      // Call the module functions
+      himmelblau.reset_and_calculate();
+      rosenbrock.reset_and_calculate();
+
+      const std::vector<double> x = {point[0], point[1]};
+      const double expected[] = {TestFunctions::himmelblau(x), TestFunctions::rosenbrock(x)};
+      const double result[] = {himmelblau(0), rosenbrock(0)};
+      std::cout << "x = (" << point[0] << ", " << point[1] << "): himmelblau " << result[0] << ", rosenbrock " << result[1] << std::endl;
+
+      if (Param[x1] != point[0] or Param[x2] != point[1])
+      {
+        std::cout << "  Parameter handles give (" << Param[x1] << ", " << Param[x2] << ")" << std::endl;
+        failures++;
+      }
+      if (values.at("x1") != point[0] or values.at("x2") != point[1])
+      {
+        std::cout << "  Parameter map gives (" << values.at("x1") << ", " << values.at("x2") << ")" << std::endl;
+        failures++;
+      }
+      if (result[0] != expected[0] or result[1] != expected[1])
+      {
+        std::cout << "  Expected himmelblau " << expected[0] << ", rosenbrock " << expected[1] << std::endl;
+        failures++;
+      }
+    }
+
+  }
+
+  catch (std::exception& e)
+  {
+    std::cout << "ObjectivesBit standalone has exited with fatal exception: " << e.what() << std::endl;
+    return 1;
+  }
+
+  if (failures != 0)
+  {
+    std::cout << std::endl << "ObjectivesBit standalone found " << failures << " mismatches." << std::endl << std::endl;
+    return 1;
+  }
+  std::cout << std::endl << "ObjectivesBit standalone has finished successfully." << std::endl << std::endl;
+  return 0;
+
+}
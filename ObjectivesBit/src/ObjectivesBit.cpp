@@ -28,6 +28,7 @@
 #include <vector>
 
 #include "gambit/Elements/gambit_module_headers.hpp"
+#include "gambit/Utils/test_functions.hpp"
 #include "gambit/ObjectivesBit/ObjectivesBit_rollcall.hpp"
 
 
@@ -37,21 +38,31 @@ namespace Gambit
   {
     typedef Gambit::Models::safe_param_map<Gambit::safe_ptr<const double>> map;
 
-    std::vector<double> get_arguments(map param)
+    /// Get handles to the parameters x1, x2, ... of a function, once per function (see safe_param_map::index)
+    std::vector<map::handle> get_handles(map& param)
     {
-      std::vector<double> x;
+      std::vector<map::handle> handles;
       for (int i = 0, n = param.size(); i < n; i++)
       {
-        std::string name = "x" + std::to_string(i + 1);
-        x.push_back(*param.at(name));
+        handles.push_back(param.index("x" + std::to_string(i + 1)));
       }
+      return handles;
+    }
+
+    /// Get the values of the parameters x1, x2, ... at the current point
+    std::vector<double> get_arguments(const map& param, const std::vector<map::handle>& handles)
+    {
+      std::vector<double> x;
+      x.reserve(handles.size());
+      for (const auto& h : handles) x.push_back(param[h]);
       return x;
     }
 
     void gaussian(double &loglike)
     {
       using namespace Pipes::gaussian;
-      auto x = get_arguments(Param);
+      static const auto handles = get_handles(Param);
+      auto x = get_arguments(Param, handles);
 
       const double mu = 0.5;
       const double sigma = 0.1;
@@ -67,45 +78,27 @@ namespace Gambit
       loglike = -0.5 * chi_sq - norm;
     }
 
-    double rosenbrock(double x, double y)
-    {
-      const double a = 1.;
-      const double b = 100.;
-      return (a - x) * (a - x) + b * (y - x * x) * (y - x * x);
-    }
-
-    double rosenbrock(std::vector<double> x)
-    {
-      const int d = x.size();
-      double r = 0.;
-      for (int i = 0; i < d - 1; i++)
-      {
-        r += rosenbrock(x[i], x[i + 1]);
-      }
-      return r;
-    }
-
     /** @brief See https://en.wikipedia.org/wiki/Rosenbrock_function */
     void rosenbrock(double &loglike)
     {
       using namespace Pipes::rosenbrock;
-      auto x = get_arguments(Param);
-      loglike = - rosenbrock(x);
+      static const auto handles = get_handles(Param);
+      loglike = TestFunctions::rosenbrock(get_arguments(Param, handles));
     }
 
     /** @brief See https://en.wikipedia.org/wiki/Himmelblau%27s_function */
     void himmelblau(double &loglike)
     {
       using namespace Pipes::himmelblau;
-      auto x = get_arguments(Param);
-      loglike = - (x[0] * x[0] + x[1] - 11.) * (x[0] * x[0] + x[1] - 11.)
-                - (x[0] + x[1] * x[1] - 7.) * (x[0] + x[1] * x[1] - 7.);
+      static const auto handles = get_handles(Param);
+      loglike = TestFunctions::himmelblau(get_arguments(Param, handles));
     }
 
     void mccormick(double &loglike)
     {
       using namespace Pipes::mccormick;
-      auto x = get_arguments(Param);
+      static const auto handles = get_handles(Param);
+      auto x = get_arguments(Param, handles);
       loglike = - std::sin(x[0] + x[1])
                 - (x[0] - x[1]) *  (x[0] - x[1])
                 + 1.5 * x[0] - 2.5 * x[1] - 1.;
@@ -115,90 +108,46 @@ namespace Gambit
     void ackley(double &loglike)
     {
       using namespace Pipes::ackley;
-      auto x = get_arguments(Param);
-      double r2 = 0.;
-      double c = 0.;
-      for (const auto& p : x)
-      {
-        r2 += p * p;
-        c += std::cos(2. * M_PI * p);
-      }
-      loglike = 20. * std::exp(-0.2 * std::sqrt(r2 / x.size()))
-                + std::exp(c / x.size())
-                - M_E - 20.;
+      static const auto handles = get_handles(Param);
+      loglike = TestFunctions::ackley(get_arguments(Param, handles));
     }
 
     /** @brief Test problem 2 from https://arxiv.org/abs/1306.2144 */
     void eggbox(double &loglike)
     {
       using namespace Pipes::eggbox;
-      auto x = get_arguments(Param);
-      double prod = 1.;
-      for (const auto& p : x)
-      {
-        prod *= std::cos(p * 5. * M_PI);
-      }
-      loglike = std::pow(prod + 2., 5.);
+      static const auto handles = get_handles(Param);
+      loglike = TestFunctions::eggbox(get_arguments(Param, handles));
     }
 
     /** @brief See https://en.wikipedia.org/wiki/Rastrigin_function */
     void rastrigin(double &loglike)
     {
       using namespace Pipes::rastrigin;
-      auto x = get_arguments(Param);
-      double r2 = 0.;
-      double c = 0.;
-      for (const auto& p : x)
-      {
-        r2 += p * p;
-        c += std::cos(2. * M_PI * p);
-      }
-      loglike = x.size() * 10. + r2 - 10. * c;
+      static const auto handles = get_handles(Param);
+      loglike = TestFunctions::rastrigin(get_arguments(Param, handles));
     }
 
     void beale(double &loglike)
     {
       using namespace Pipes::beale;
-      auto x = get_arguments(Param);
-      loglike = - std::pow(1.5 - x[0] - x[1] * x[0], 2)
-                - std::pow(2.25 - x[0] - x[1] * x[1] * x[0], 2)
-                - std::pow(2.625 - x[0] - x[1] * x[1] * x[1] * x[0], 2);
-    }
-
-    double logaddexp(double x, double y)
-    {
-      return std::max(x, y) + std::log1p(std::exp(-std::abs(x - y)));
+      static const auto handles = get_handles(Param);
+      loglike = TestFunctions::beale(get_arguments(Param, handles));
     }
 
     /** @brief Test problem 1 from https://arxiv.org/abs/1306.2144 */
     void shells(double &loglike)
     {
       using namespace Pipes::shells;
-      auto x = get_arguments(Param);
-
-      const double radius = 0.1;
-      const double width = 2.;
-      const std::vector<double> center = {-3.5, 3.5};
-      static double norm = - 0.5 * std::log(2. * M_PI * width * width);
-
-      loglike = std::numeric_limits<double>::lowest();
-      for (const auto& c : center)
-      {
-        double r2 = 0.;
-        for (const auto& p : x)
-        {
-          r2 += (c - p) * (c - p);
-        }
-        double d = (std::sqrt(r2) - radius) * (std::sqrt(r2) - radius);
-        double delta = -d / (2. * width * width) - norm;
-        loglike = logaddexp(loglike, delta);
-      }
+      static const auto handles = get_handles(Param);
+      loglike = TestFunctions::shells(get_arguments(Param, handles));
     }
 
     void styblinski_tang(double &loglike)
     {
       using namespace Pipes::styblinski_tang;
-      auto x = get_arguments(Param);
+      static const auto handles = get_handles(Param);
+      auto x = get_arguments(Param, handles);
 
       loglike = 0.;
 
@@ -212,7 +161,8 @@ namespace Gambit
     void easom(double &loglike)
     {
       using namespace Pipes::easom;
-      auto x = get_arguments(Param);
+      static const auto handles = get_handles(Param);
+      auto x = get_arguments(Param, handles);
       loglike = std::cos(x[0]) * std::cos(x[1]) *
                 std::exp(- (x[0] - M_PI) * (x[0] - M_PI) - (x[1] - M_PI) * (x[1] - M_PI));
     }
@@ -221,7 +171,8 @@ namespace Gambit
     void tf1(double &loglike)
     {
       using namespace Pipes::tf1;
-      auto x = get_arguments(Param);
+      static const auto handles = get_handles(Param);
+      auto x = get_arguments(Param, handles);
 
       const double location = 2.;
       static const double scale = std::pow(15., 6);
@@ -246,7 +197,8 @@ namespace Gambit
     void tf2(double &loglike)
     {
       using namespace Pipes::tf2;
-      auto x = get_arguments(Param);
+      static const auto handles = get_handles(Param);
+      auto x = get_arguments(Param, handles);
 
       const double location = -0.23;
 
@@ -262,7 +214,8 @@ namespace Gambit
     void tf3(double &loglike)
     {
       using namespace Pipes::tf3;
-      auto x = get_arguments(Param);
+      static const auto handles = get_handles(Param);
+      auto x = get_arguments(Param, handles);
 
       const int n = x.size();
 
@@ -280,7 +233,8 @@ namespace Gambit
     void tf4(double &loglike)
     {
       using namespace Pipes::tf4;
-      auto x = get_arguments(Param);
+      static const auto handles = get_handles(Param);
+      auto x = get_arguments(Param, handles);
 
       const int n = x.size();
 
@@ -285,6 +285,7 @@ namespace Gambit
         virtual ulong    get_current_index() = 0; // Get a linear index which corresponds to the current rank/ptID pair in the iterative sense
         virtual PPIDpair get_next_point() = 0; // Get next rank/ptID pair in data file
         virtual bool eoi() = 0; // Check if 'current point' is past the end of the data file (and thus invalid!)
+        virtual void set_read_range(ulong /*start*/, ulong /*end*/) {} // Hint that only entries start..end (inclusive) will be read next, so that reads can be sized to match (ignored by default)
 
         /// Printer-retrieve dispatch function. If a virtual function override exists for
         /// the retrieve type, info is passed on, otherwise the function call is resolved
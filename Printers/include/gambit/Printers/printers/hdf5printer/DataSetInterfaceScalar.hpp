@@ -25,6 +25,8 @@
 
 #include <sstream>
 #include <iostream>
+#include <limits>
+#include <algorithm>
 
 // HDF5 C bindings
 #include <hdf5.h> 
@@ -49,6 +51,7 @@ namespace Gambit {
 
           std::vector<T> read_buffer; // Buffer to store a chunk of the linked dataset (during read operations)
           std::size_t    read_buffer_start; // Index of start of read buffer
+          std::size_t    read_length; // Number of entries to read into the buffer at once
 
         public: 
           /// Constructors
@@ -73,8 +76,16 @@ namespace Gambit {
          // Extracts the ith chunk of length CHUNKLENGTH from the dataset
          std::vector<T> get_chunk(std::size_t i, std::size_t length) const;
 
-         // Extract entry at given index from dataset
-         T get_entry(std::size_t index);
+         // As get_chunk, but reads into an existing buffer (re-using its memory)
+         void read_chunk(std::size_t offset, std::size_t length, std::vector<T>& chunkdata) const;
+
+         // Extract entry at given index from dataset. If the entry is not buffered, up to read_length
+         // entries are read starting from it, but none at or beyond read_end.
+         T get_entry(std::size_t index, std::size_t read_end = std::numeric_limits<std::size_t>::max());
+
+         // Set the maximum number of entries read in one go by get_entry (CHUNKLENGTH by default).
+         // Larger values give fewer, larger contiguous reads when iterating through the dataset.
+         void set_read_length(std::size_t length) { read_length = (length > 0 ? length : CHUNKLENGTH); }
 
          /// @}
 
@@ -90,11 +101,15 @@ namespace Gambit {
       template<class T, std::size_t CL>
       DataSetInterfaceScalar<T,CL>::DataSetInterfaceScalar() 
         : DataSetInterfaceBase<T,0,CL>()
+        , read_buffer_start(0)
+        , read_length(CL)
       {}
 
       template<class T, std::size_t CL>
       DataSetInterfaceScalar<T,CL>::DataSetInterfaceScalar(hid_t location_id, const std::string& name, const bool resume, const char access) 
         : DataSetInterfaceBase<T,0,CL>(location_id, name, empty_rdims, resume, access)
+        , read_buffer_start(0)
+        , read_length(CL)
       {}
 
       template<class T, std::size_t CHUNKLENGTH>
@@ -375,7 +390,16 @@ namespace Gambit {
      std::vector<T> DataSetInterfaceScalar<T,CHUNKLENGTH>::get_chunk(std::size_t offset, std::size_t length) const
      {
          // Buffer to receive data (and return from function)
-         std::vector<T> chunkdata(length);
+         std::vector<T> chunkdata;
+         read_chunk(offset, length, chunkdata);
+         return chunkdata;
+     }
+
+     /// Extract a data slice from the linked dataset into an existing buffer
+     template<class T, std::size_t CHUNKLENGTH>
+     void DataSetInterfaceScalar<T,CHUNKLENGTH>::read_chunk(std::size_t offset, std::size_t length, std::vector<T>& chunkdata) const
+     {
+         chunkdata.resize(length);
  
          // Select hyperslab
          std::pair<hid_t,hid_t> selection_ids = select_chunk(offset,length);
@@ -399,41 +423,37 @@ namespace Gambit {
 
          H5Sclose(dspace_id);
          H5Sclose(memspace_id);
-
-         return chunkdata;
      }
 
      /// Extract a single entry from a linked dataset
      template<class T, std::size_t CHUNKLENGTH>
-     T DataSetInterfaceScalar<T,CHUNKLENGTH>::get_entry(std::size_t index)
+     T DataSetInterfaceScalar<T,CHUNKLENGTH>::get_entry(std::size_t index, std::size_t read_end)
      {
-        // Figure out relevant chunk start index and position of desired entry in the chunk.
-        std::size_t chunk_start = (index / CHUNKLENGTH) * CHUNKLENGTH;
-        std::size_t chunk_relative_index = index % CHUNKLENGTH;
-
         #ifdef HDF5_DEBUG
         std::cout << "index      :" << index << std::endl;
-        std::cout << "chunk_start:" << chunk_start << std::endl;
-        std::cout << "chunk_rel  :" << chunk_relative_index << std::endl;
+        std::cout << "buff_start :" << read_buffer_start << std::endl;
+        std::cout << "buff_length:" << read_buffer.size() << std::endl;
         #endif
 
         // Figure out whether entry is already in the read buffer
-        if(read_buffer.size()==0 or read_buffer_start!=chunk_start)
+        if(index < read_buffer_start or index >= read_buffer_start + read_buffer.size())
         {
-           // Nope, don't have it, read in the appropriate chunk
-           #ifdef HDF5_DEBUG
-           std::cout << "extracting new chunk starting from "<<chunk_start<< std::endl;
-           #endif
-           // Make sure we don't try to read past the end of the dataset
-           std::size_t length = CHUNKLENGTH; 
-           if(chunk_start+length > this->dset_length())
+           // Nope, don't have it, read in a new chunk starting from this entry.
+           // Stop at read_end (the end of the range the caller needs), unless the caller is already
+           // past it, in which case read just this entry. Never read past the end of the dataset.
+           std::size_t length = (index < read_end ? std::min(read_length, read_end - index) : 1);
+           if(index+length > this->dset_length())
            {
-              length = this->dset_length() - chunk_start;
+              length = (index < this->dset_length() ? this->dset_length() - index : 0);
            }
-           read_buffer = get_chunk(chunk_start, length);
-           read_buffer_start = chunk_start;
+           #ifdef HDF5_DEBUG
+           std::cout << "extracting new chunk of length "<<length<<" starting from "<<index<< std::endl;
+           #endif
+           read_chunk(index, length, read_buffer);
+           read_buffer_start = index;
         }
 
+        std::size_t chunk_relative_index = index - read_buffer_start;
         return read_buffer.at(chunk_relative_index);
      }
 
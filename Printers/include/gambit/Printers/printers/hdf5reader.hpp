@@ -95,8 +95,9 @@ namespace Gambit
         }
 
         /// Retrieve a buffer for an IDcode/auxilliary-index pair
-        /// location_id used to access dataset if it has not yet been opened.
-        BuffPair<T>& get_buffer(const int vID, const unsigned int i, const std::string& label, hid_t location_id);
+        /// location_id used to access dataset if it has not yet been opened,
+        /// in which case read_length entries will be read from it at a time.
+        BuffPair<T>& get_buffer(const int vID, const unsigned int i, const std::string& label, hid_t location_id, std::size_t read_length);
     };
 
     // A simple class to manage opening and closing a HDF5 file/group on construction and destruction
@@ -122,6 +123,7 @@ namespace Gambit
         virtual PPIDpair get_current_point(); // Get current rank/ptID pair in data file
         virtual ulong    get_current_index(); // Get a linear index which corresponds to the current rank/ptID pair in the iterative sense
         virtual bool eoi(); // Check if 'current point' is past the end of the data file (and thus invalid!)
+        virtual void set_read_range(ulong start, ulong end); // Only read entries up to 'end' (inclusive) from now on
         /// Get type information for a data entry, i.e. defines the C++ type which this should be
         /// retrieved as, not what it is necessarily literally stored as in the output.
         virtual std::size_t get_type(const std::string& label);
@@ -145,6 +147,12 @@ namespace Gambit
         // Names of all datasets at the target location
         const std::vector<std::string> all_datasets;
 
+        // Maximum number of entries of each dataset read in one go as the read head moves through the file
+        const std::size_t read_length;
+
+        // Index one past the last entry in the range currently being read (see set_read_range)
+        ulong read_end;
+
         // MPIrank and pointID dataset wrappers
         DataSetInterfaceScalar<unsigned long, CHUNKLENGTH> pointIDs;
         DataSetInterfaceScalar<int, CHUNKLENGTH> pointIDs_isvalid;
@@ -192,16 +200,16 @@ namespace Gambit
            int IDcode = get_param_id(label);
 
            // Extract a buffer pair from the manager corresponding to this type + label
-           auto& selected_buffer = buffer_manager.get_buffer(IDcode, aux_id, label, H5file.location_id);
+           auto& selected_buffer = buffer_manager.get_buffer(IDcode, aux_id, label, H5file.location_id, read_length);
 
            // Determine the dataset index from which to extrat the input PPIDpair
            ulong dset_index = get_index_from_PPID(PPIDpair(pointID,rank));
 
            // Extract data value
-           out = selected_buffer.data.get_entry(dset_index);
+           out = selected_buffer.data.get_entry(dset_index, read_end);
 
            // Extract data validity flag
-           return selected_buffer.isvalid.get_entry(dset_index);
+           return selected_buffer.isvalid.get_entry(dset_index, read_end);
         }
 
         /// Extra helper function for spectrum retrieval
@@ -211,7 +219,7 @@ namespace Gambit
 
     /// Buffer retrieve function
     template<class T>
-    BuffPair<T>& H5P_LocalReadBufferManager<T>::get_buffer(const int vertexID, const unsigned int aux_i, const std::string& label, hid_t location_id)
+    BuffPair<T>& H5P_LocalReadBufferManager<T>::get_buffer(const int vertexID, const unsigned int aux_i, const std::string& label, hid_t location_id, std::size_t read_length)
     {
      VBIDpair key;
      key.vertexID = vertexID;
@@ -236,6 +244,11 @@ namespace Gambit
 
        // Get the new buffer back out of the map
        it = local_buffers.find(key);
+       if( it != local_buffers.end() )
+       {
+         it->second.data.set_read_length(read_length);
+         it->second.isvalid.set_read_length(read_length);
+       }
      }
 
      if( it == local_buffers.end() )
@@ -33,6 +33,7 @@
 #include "gambit/Utils/standalone_error_handlers.hpp"
 #include "gambit/Utils/stream_overloads.hpp"
 #include "gambit/Utils/util_functions.hpp"
+#include "gambit/Utils/profiler.hpp"
 
 // MPI bindings
 #include "gambit/Utils/mpiwrapper.hpp"
@@ -313,6 +314,7 @@ namespace Gambit
     // write the printer buffer to file
     void asciiPrinter::dump_buffer(bool force)
     {
+      Utils::profile_scope profile("printer", "asciiPrinter", "dump_buffer");
       // Write record of what is in each column if we haven't done so yet
       // Note the downside of using a map as the buffer; the order of stuff in the output file is going
       // to be kind of haphazard due to the sorted order used by map. Will have to do more work to achieve
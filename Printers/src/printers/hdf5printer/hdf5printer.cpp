@@ -106,6 +106,7 @@
 #include "gambit/Utils/stream_overloads.hpp"
 #include "gambit/Utils/util_functions.hpp"
 #include "gambit/Utils/signal_handling.hpp"
+#include "gambit/Utils/profiler.hpp"
 #include "gambit/Logs/logger.hpp"
 
 // MPI bindings
@@ -1288,6 +1289,7 @@ namespace Gambit
     // flag to force the flush for the finalise buffer dumps.
     void HDF5Printer::empty_sync_buffers(bool force)
     {
+      Utils::profile_scope profile("printer", "HDF5Printer", "empty_sync_buffers");
 #ifdef DEBUG_MODE
       std::cout<<"rank "<<myRank<<": Emptying sync buffers (if full)..."<<std::endl;
 #endif
@@ -74,6 +74,8 @@ namespace Gambit
       , group( options.getValue<std::string>("group") )
       , H5file(file,group)
       , all_datasets(lsGroup_process(H5file.location_id))
+      , read_length(options.getValueOrDef<std::size_t>(10000, "read_buffer_length"))
+      , read_end(std::numeric_limits<ulong>::max())
       , pointIDs        (H5file.location_id, "pointID", true, 'r')
       , pointIDs_isvalid(H5file.location_id, "pointID_isvalid", true, 'r')
       , mpiranks        (H5file.location_id, "MPIrank", true, 'r')
@@ -105,6 +107,13 @@ namespace Gambit
          errmsg << "This most likely indicates corruption of the datasets (possibly due to unsafe shutdown).";
          printer_error().raise(LOCAL_INFO, errmsg.str());
        }
+
+       // Read the point identifiers in large contiguous blocks, as they are needed for every point.
+       // Reads are further capped at the end of the range set by set_read_range.
+       pointIDs.set_read_length(read_length);
+       pointIDs_isvalid.set_read_length(read_length);
+       mpiranks.set_read_length(read_length);
+       mpiranks_isvalid.set_read_length(read_length);
        //std::cout<<"Created HDF5 reader object for file "<<file<<std::endl;
      }
 
@@ -152,12 +161,12 @@ namespace Gambit
         }
         else
         {
-          bool pvalid = pointIDs_isvalid.get_entry(current_dataset_index);
-          bool mvalid = mpiranks_isvalid.get_entry(current_dataset_index);
+          bool pvalid = pointIDs_isvalid.get_entry(current_dataset_index, read_end);
+          bool mvalid = mpiranks_isvalid.get_entry(current_dataset_index, read_end);
           if(pvalid and mvalid)
           {
-            unsigned long pid = pointIDs.get_entry(current_dataset_index);
-            int mpirank       = mpiranks.get_entry(current_dataset_index);
+            unsigned long pid = pointIDs.get_entry(current_dataset_index, read_end);
+            int mpirank       = mpiranks.get_entry(current_dataset_index, read_end);
             current_point = PPIDpair(pid,mpirank);
           }
           else
@@ -183,6 +192,14 @@ namespace Gambit
         return result;
      }
 
+     /// Only read entries up to 'end' (inclusive) from now on, e.g. the end of the chunk of
+     /// points assigned to this process, so that buffers are not filled with entries that
+     /// this process will never use.
+     void HDF5Reader::set_read_range(ulong /*start*/, ulong end)
+     {
+        read_end = end + 1;
+     }
+
      /// Get type information for a data entry, i.e. defines the C++ type which this should be
      /// retrieved as, not what it is necessarily literally stored as in the output.
      std::size_t HDF5Reader::get_type(const std::string& label)
@@ -20,6 +20,7 @@
 #include "gambit/Printers/printers/hdf5printer/hdf5tools.hpp"
 #include "gambit/Printers/printers/hdf5printer_v2.hpp"
 #include "gambit/Utils/util_functions.hpp"
+#include "gambit/Utils/profiler.hpp"
 
 // Helper to check next item in iteration
 //template <typename Iter>
@@ -462,6 +463,7 @@ namespace Gambit
     /// (or as much of them as is currently possible in RA case)
     void HDF5MasterBuffer::flush()
     {
+        Utils::profile_scope profile("printer", "HDF5MasterBuffer", "flush");
         if(get_Npoints()>0) // No point trying to flush an already empty buffer
         {
             // Obtain lock on the output file
@@ -29,6 +29,7 @@
 // Gambit
 #include "gambit/Printers/printers/sqliteprinter.hpp"
 #include "gambit/Logs/logger.hpp"
+#include "gambit/Utils/profiler.hpp"
 
 // Define this macro to dump attempted SQL statements during exceptions
 #define SQL_DEBUG
@@ -551,6 +552,7 @@ namespace Gambit
    
     void SQLitePrinter::dump_buffer()
     {
+        Utils::profile_scope profile("printer", "SQLitePrinter", "dump_buffer");
         require_output_ready();
         // Don't try to dump the buffer if it is empty!
         if(transaction_data_buffer.size()>0)
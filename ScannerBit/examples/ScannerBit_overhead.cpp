@@ -0,0 +1,421 @@
+//  GAMBIT: Global and Modular BSM Inference Tool
+//  *********************************************
+///  \file
+///
+///  Microbenchmark of the fixed cost that the
+///  framework adds to each likelihood call.
+///
+///  Sets up the printer, prior and objective
+///  plugins in the same way as
+///  ScannerBit_standalone, from an inifile with
+///  a constant objective (by default
+///  yaml_files/ScannerBit_overhead.yaml), then
+///  times each layer of the per-point path on
+///  its own and reports the nanoseconds and heap
+///  allocations per point of each.
+///
+///  In the full GAMBIT build, an inifile with
+///  ObsLikes (e.g. yaml_files/
+///  ScannerBit_overhead_gambit.yaml) is resolved
+///  as gambit does, and the Likelihood_Container
+///  of its functor graph is timed against a bare
+///  like_ptr around a constant function.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#include <map>
+#include <new>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <memory>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <unordered_map>
+#ifdef WITH_MPI
+  #include "gambit/Utils/begin_ignore_warnings_mpi.hpp"
+  #include <mpi.h>
+  #include "gambit/Utils/end_ignore_warnings.hpp"
+#endif
+
+#include <getopt.h>
+
+#include "gambit/Logs/logger.hpp"
+#include "gambit/Printers/printermanager.hpp"
+#include "gambit/Printers/printer_id_tools.hpp"
+#include "gambit/Utils/yaml_parser_base.hpp"
+#include "gambit/Utils/signal_handling.hpp"
+#include "gambit/ScannerBit/plugin_factory.hpp"
+#include "gambit/ScannerBit/plugin_loader.hpp"
+#include "gambit/ScannerBit/priors/composite.hpp"
+#ifndef SCANNER_STANDALONE
+  #include "gambit/Elements/functors.hpp"
+  #include "gambit/Elements/functor_definitions.hpp"
+  #include "gambit/Elements/equivalency_singleton.hpp"
+  #include "gambit/Models/claw_singleton.hpp"
+  #include "gambit/Core/core_singleton.hpp"
+  #include "gambit/Core/depresolver.hpp"
+  #include "gambit/Core/yaml_parser.hpp"
+  #include "gambit/Core/likelihood_container.hpp"
+#endif
+
+using namespace Gambit;
+using namespace Gambit::Scanner;
+
+namespace
+{
+    /// Number of heap allocations made so far by the whole program
+    std::atomic<unsigned long long> allocations(0);
+}
+
+void *operator new(std::size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void *ptr = std::malloc(size ? size : 1)) return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace
+{
+    typedef Function_Base<double (std::unordered_map<std::string, double> &)> loglike_function;
+
+    /// Likelihood that does no work, to measure the bookkeeping of Function_Base and like_ptr around main
+    class constant_function : public loglike_function
+    {
+    public:
+        double main(std::unordered_map<std::string, double> &) {return 0.;}
+    };
+
+    #ifndef SCANNER_STANDALONE
+        /// Module function that does no work, for the functor layers
+        void constant_likelihood(double &result)
+        {
+            result = 0.;
+        }
+    #endif
+
+    /// Time per point and allocations per point of one layer
+    struct layer_cost
+    {
+        std::string name;
+        double ns;
+        double allocs;
+    };
+
+    /// Call f(i) for i = 0 ... n-1, after a warm-up, and return the time and allocations per call
+    template <typename F>
+    layer_cost time_layer(const std::string &name, unsigned long long n, F f)
+    {
+        for (unsigned long long i = 0; i < std::min(n, 1000ULL); i++) f(i);
+
+        const unsigned long long allocs = allocations.load();
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (unsigned long long i = 0; i < n; i++) f(i);
+        const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+        return {name, std::chrono::duration<double, std::nano>(end - start).count()/n, double(allocations.load() - allocs)/n};
+    }
+
+    void usage()
+    {
+        std::cout << "\nusage: ScannerBit_overhead [options]                                        "
+                     "\n                                                                           "
+                     "\nTime each layer that GAMBIT adds around a likelihood call, with a constant "
+                     "\nlikelihood, and report the nanoseconds and heap allocations per point.     "
+                     "\n                                                                           "
+                     "\nOptions:                                                                   "
+                     "\n   -h/--help             Display this usage information                    "
+                     "\n   -f <inifile>          Printer, parameters and objective to use          "
+                     "\n                         (default yaml_files/ScannerBit_overhead.yaml), or "
+                     "\n                         a GAMBIT inifile with ObsLikes to time the        "
+                     "\n                         Likelihood_Container of its functor graph         "
+                     "\n                         (e.g. yaml_files/ScannerBit_overhead_gambit.yaml) "
+                     "\n   -n <points>           Number of points timed per layer (default 100000) "
+                     "\n   -m <functors>         Number of functors reset and calculated per point "
+                     "\n                         (default 10)                                      "
+                     "\n" << std::endl;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::string filename = "yaml_files/ScannerBit_overhead.yaml";
+    unsigned long long npoints = 100000;
+    int nfunctors = 10;
+
+    const struct option options[] =
+    {
+        {"help", no_argument, 0, 'h'},
+        {0,0,0,0},
+    };
+    int iarg, index;
+    while ((iarg = getopt_long(argc, argv, "hf:n:m:", options, &index)) != -1)
+    {
+        switch (iarg)
+        {
+            case 'f':
+                filename = optarg;
+                break;
+            case 'n':
+                npoints = std::max(1ULL, std::strtoull(optarg, NULL, 10));
+                break;
+            case 'm':
+                nfunctors = std::max(0, std::atoi(optarg));
+                break;
+            default:
+                usage();
+                return EXIT_SUCCESS;
+        }
+    }
+
+    #ifdef WITH_MPI
+        GMPI::Init();
+    #endif
+
+    int return_value(EXIT_SUCCESS);
+
+    {
+        #ifdef WITH_MPI
+            GMPI::Comm scanComm;
+            scanComm.dup(MPI_COMM_WORLD,"scanComm");
+            Scanner::Plugins::plugin_info.initMPIdata(&scanComm);
+            int rank = scanComm.Get_rank();
+        #else
+            int rank = 0;
+        #endif
+
+        try
+        {
+            #ifdef SCANNER_STANDALONE
+                IniParser::Parser iniFile;
+            #else
+                IniParser::IniFile iniFile;
+            #endif
+            iniFile.readFile(filename);
+
+            // Set up the printer and prior as Scan_Manager does.
+            Printers::PrinterManager printerManager(iniFile.getPrinterNode(), false);
+            Options scanner_options(iniFile.getScannerNode());
+            Scanner::Plugins::plugin_info.iniFile(scanner_options);
+            Priors::CompositePrior prior(iniFile.getParametersNode(), iniFile.getPriorsNode());
+            Scanner::Plugins::plugin_info.printer_prior(printerManager, prior);
+            printer *main_printer = printerManager.get_stream();
+
+            #ifndef SCANNER_STANDALONE
+                // Resolve the likelihoods asked for in ObsLikes (if any) as gambit does.  This must come before any
+                // other printer IDs are taken, so that they do not collide with the vertex IDs of the functor graph.
+                std::unique_ptr<DRes::DependencyResolver> dependencyResolver;
+                std::unique_ptr<like_ptr> GambitLogLike;
+                if (not iniFile.getObservables().empty())
+                {
+                    Core().registerActiveModelFunctors(Models::ModelDB().getPrimaryModelFunctorsToActivate(iniFile.getModelNames(), Core().getPrimaryModelFunctors()));
+                    Core().accountForMissingClasses();
+                    set_global_printer_manager(&printerManager);
+                    dependencyResolver.reset(new DRes::DependencyResolver(Core(), Models::ModelDB(), iniFile, Utils::typeEquivalencies(), *(printerManager.printerptr)));
+                    dependencyResolver->doResolution();
+                    Likelihood_Container_Factory gambit_factory(Core(), *dependencyResolver, iniFile, *(printerManager.printerptr));
+                    GambitLogLike.reset(new like_ptr(gambit_factory("LogLike")));
+                    (*GambitLogLike)->setPurpose("LogLike");
+                    (*GambitLogLike)->setPrinter(main_printer);
+                    (*GambitLogLike)->setPrior(&prior);
+                }
+            #endif
+
+            // The objective plugin, if the inifile names one
+            std::string objective;
+            std::unique_ptr<Plugin_Function_Factory> factory;
+            std::unique_ptr<like_ptr> LogLike;
+            if (scanner_options.hasKey("use_objectives"))
+            {
+                objective = get_yaml_vector<std::string>(scanner_options.getNode("use_objectives")).at(0);
+                std::map<std::string, std::vector<std::pair<std::string, std::string>>> names;
+                names["LogLike"].push_back(std::make_pair(objective, scanner_options.getValue<std::string>("objectives", objective, "plugin")));
+                factory.reset(new Plugin_Function_Factory(prior.getParameters(), names));
+                LogLike.reset(new like_ptr((*factory)("LogLike")));
+                (*LogLike)->setPurpose("LogLike");
+                (*LogLike)->setPrinter(main_printer);
+                (*LogLike)->setPrior(&prior);
+            }
+
+            // A constant function, called through like_ptr in the same way as the objective or the likelihood container
+            like_ptr BareLogLike(static_cast<void*>(static_cast<loglike_function*>(new constant_function)));
+            BareLogLike->setPurpose("LogLike");
+            BareLogLike->setPrinter(main_printer);
+            BareLogLike->setPrior(&prior);
+            assign_aux_numbers("LogLike", "pointID", "MPIrank");
+
+            // Points in the unit hypercube to cycle through
+            const size_t dim = prior.size();
+            std::vector<std::vector<double>> units(1024, std::vector<double>(dim));
+            std::mt19937_64 rng(0);
+            std::uniform_real_distribution<double> uniform(0., 1.);
+            for (auto &unit : units) for (auto &u : unit) u = uniform(rng);
+            auto unit = [&](unsigned long long i) -> const std::vector<double>& { return units[i % units.size()]; };
+
+            std::vector<layer_cost> costs;
+            std::unordered_map<std::string, double> map;
+
+            // Unit hypercube to physical parameters
+            costs.push_back(time_layer("prior transform", npoints, [&](unsigned long long i)
+            {
+                prior.transform(unit(i), map);
+            }));
+
+            // What Function_Base::operator() does around the likelihood (point ID and calculating flag)
+            constant_function constant;
+            costs.push_back(time_layer("likelihood bookkeeping", npoints, [&](unsigned long long)
+            {
+                constant(map);
+            }));
+
+            // The checks for shutdown signals made by the objective and the likelihood container
+            volatile int signals = 0;
+            costs.push_back(time_layer("signal checks", npoints, [&](unsigned long long)
+            {
+                if (signaldata().check_if_shutdown_begun()) signals = signals + 1;
+                if (signaldata().shutdown_begun()) signals = signals + 1;
+            }));
+
+            #ifndef SCANNER_STANDALONE
+                // What the dependency resolver does with each functor at each point
+                Models::ModelFunctorClaw claw;
+                std::vector<std::unique_ptr<module_functor<double>>> functors;
+                for (int i = 0; i < nfunctors; i++)
+                {
+                    functors.emplace_back(new module_functor<double>(&constant_likelihood, "constant_likelihood_" + std::to_string(i),
+                                                                     "constant_likelihood", "double", "ScannerBit_overhead", claw));
+                }
+                costs.push_back(time_layer("functor resets (" + std::to_string(nfunctors) + ")", npoints, [&](unsigned long long)
+                {
+                    for (auto &f : functors) f->reset();
+                }));
+                costs.push_back(time_layer("functor resets and calculations (" + std::to_string(nfunctors) + ")", npoints, [&](unsigned long long)
+                {
+                    for (auto &f : functors)
+                    {
+                        f->reset();
+                        f->calculate();
+                    }
+                }));
+            #endif
+
+            // The printer calls made at each point by the objective (parameters) and like_ptr (everything else).
+            // The physical parameters of each point are computed beforehand, so that only the printer is timed.
+            std::vector<std::string> keys = prior.getParameters();
+            std::vector<std::vector<double>> physicals(units.size(), std::vector<double>(keys.size()));
+            for (size_t j = 0; j < units.size(); j++)
+            {
+                prior.transform(units[j], map);
+                for (size_t k = 0; k < keys.size(); k++) physicals[j][k] = map[keys[k]];
+            }
+            std::vector<int> key_ids;
+            for (auto &key : keys) key_ids.push_back(Printers::get_main_param_id(key));
+            const std::string loglike_label("LogLike"), modified_label("ModifiedLogLike"), unitcube_label("unitCubeParameters"),
+                              pointid_label("pointID"), rank_label("MPIrank");
+            const int loglike_id = Printers::get_param_id(loglike_label), modified_id = Printers::get_param_id(modified_label),
+                      unitcube_id = Printers::get_param_id(unitcube_label), pointid_id = Printers::get_param_id(pointid_label),
+                      rank_id = Printers::get_param_id(rank_label);
+            costs.push_back(time_layer("printer calls", npoints, [&](unsigned long long i)
+            {
+                const std::vector<double> &physical = physicals[i % physicals.size()];
+                const unsigned long long id = ++Printers::get_point_id();
+                for (size_t k = 0; k < keys.size(); k++) main_printer->print(physical[k], keys[k], key_ids[k], rank, id);
+                main_printer->print(0., loglike_label, loglike_id, rank, id);
+                main_printer->print(0., modified_label, modified_id, rank, id);
+                if (main_printer->get_printUnitcube()) main_printer->print(unit(i), unitcube_label, unitcube_id, rank, id);
+                main_printer->print(id, pointid_label, pointid_id, rank, id);
+                main_printer->print(rank, rank_label, rank_id, rank, id);
+            }));
+
+            // Everything ScannerBit does for a scanner's call of the likelihood, around a function that does no work
+            costs.push_back(time_layer("full point (bare like_ptr)", npoints, [&](unsigned long long i)
+            {
+                BareLogLike(unit(i));
+            }));
+
+            // The same, through the objective plugin
+            if (LogLike)
+            {
+                costs.push_back(time_layer("full point (" + objective + " objective)", npoints, [&](unsigned long long i)
+                {
+                    (*LogLike)(unit(i));
+                }));
+            }
+
+            #ifndef SCANNER_STANDALONE
+                // The same, through Likelihood_Container::main and the functor graph resolved from ObsLikes
+                if (GambitLogLike)
+                {
+                    costs.push_back(time_layer("full point (Likelihood_Container)", npoints, [&](unsigned long long i)
+                    {
+                        (*GambitLogLike)(unit(i));
+                    }));
+                }
+            #endif
+
+            printerManager.finalise();
+
+            if (rank == 0)
+            {
+                std::cout << std::endl << "Cost per point of each layer, over " << npoints << " points:" << std::endl << std::endl;
+                std::cout << std::left << std::setw(40) << "Layer" << std::right << std::setw(14) << "ns/point" << std::setw(20) << "allocations/point" << std::endl;
+                for (auto &cost : costs)
+                {
+                    std::cout << std::left << std::setw(40) << cost.name << std::right << std::fixed << std::setprecision(1) << std::setw(14) << cost.ns
+                              << std::setprecision(2) << std::setw(20) << cost.allocs << std::endl;
+                }
+                std::cout << std::endl << "The prior transform and printer calls are included again in each full point." << std::endl;
+                #ifdef SCANNER_STANDALONE
+                    std::cout << "Likelihood_Container::main is not measured, as it needs the full GAMBIT build." << std::endl;
+                #else
+                    if (GambitLogLike)
+                    {
+                        std::cout << "The Likelihood_Container row less the bare like_ptr row is the cost of Likelihood_Container::main" << std::endl
+                                  << "and the functor graph." << std::endl;
+                    }
+                    else
+                    {
+                        std::cout << "Likelihood_Container::main is not measured, as the inifile has no ObsLikes" << std::endl
+                                  << "(see yaml_files/ScannerBit_overhead_gambit.yaml)." << std::endl;
+                    }
+                #endif
+            }
+        }
+
+        catch (const std::exception& e)
+        {
+            if (rank == 0)
+            {
+                std::cout << std::endl << " \033[00;31;1mFATAL ERROR\033[00m" << std::endl << std::endl;
+                std::cout << "ScannerBit_overhead has exited with fatal exception: " << e.what() << std::endl;
+            }
+            return_value = EXIT_FAILURE;
+        }
+    }
+
+    #ifdef WITH_MPI
+        GMPI::Finalize();
+    #endif
+
+    return return_value;
+}
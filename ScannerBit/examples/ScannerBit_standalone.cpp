@@ -12,6 +12,9 @@
 ///          (gregory.david.martinez@gmail.com)
 ///  \date 2015 Feb, Mar
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
 #include <map>
@@ -269,8 +272,9 @@ int main(int argc, char **argv)
                     use_mpi_abort = iniFile.getValueOrDef<bool>(true, "use_mpi_abort");
                 #endif
 
-                // Initialise the random number generator, letting the RNG class choose its own default.
-                Random::create_rng_engine(iniFile.getValueOrDef<std::string>("default", "rng"));
+                // Initialise the random number generator, letting the RNG class choose its own defaults.
+                Options rng(iniFile.getValueOrDef<YAML::Node>(YAML::Node(), "rng"));
+                Random::create_rng_engine(rng.getValueOrDef<std::string>("default", "generator"), rng.getValueOrDef<int>(-1, "seed"));
 
                 // Set up the printer (redirection of scan output)
                 Printers::PrinterManager printerManager(iniFile.getPrinterNode(),resume);
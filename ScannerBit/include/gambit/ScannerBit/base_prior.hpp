@@ -28,6 +28,7 @@
 #include <string>
 #include <unordered_map>
 #include <vector>
+#include <algorithm>
 
 
 namespace Gambit
@@ -45,6 +46,16 @@ namespace Gambit
      protected:
       std::vector<std::string> param_names;
 
+      /// Positions of param_names in the output of the array transform (unused_index if not wanted; see setOutputOrder)
+      std::vector<size_t> output_index;
+
+      /// Number of parameters in the output of the array transform
+      size_t output_size = 0;
+
+      /// Scratch space for the generic array and batch transforms
+      mutable std::vector<double> scratch_unit, scratch_point, scratch_physical;
+      mutable std::unordered_map<std::string, double> scratch_map;
+
      public:
       virtual ~BasePrior() = default;
 
@@ -65,6 +76,55 @@ namespace Gambit
       /** @brief Transform from parameter back to unit hypercube */
       virtual std::vector<double> inverse_transform(const std::unordered_map<std::string, double> &) const = 0;
 
+      /// Marks a parameter that is not written by the array transform
+      static constexpr size_t unused_index = size_t(-1);
+
+      /** @brief Set the order of the parameters in the output of the array transform.  Must be called before
+                 transform_array.  Parameters not in names are computed but not written. */
+      virtual void setOutputOrder(const std::vector<std::string> &names)
+      {
+        output_size = names.size();
+        output_index.assign(param_names.size(), size_t(unused_index));
+        for (size_t i = 0; i < param_names.size(); i++)
+        {
+          auto it = std::find(names.begin(), names.end(), param_names[i]);
+          if (it != names.end()) output_index[i] = it - names.begin();
+        }
+      }
+
+      /** @brief Transform from unit hypercube to parameters, stored in the order set by setOutputOrder.
+                 This generic version goes through the map transform; priors should override it to avoid that. */
+      virtual void transform_array(const double *unit, double *physical) const
+      {
+        scratch_unit.assign(unit, unit + size());
+        transform(scratch_unit, scratch_map);
+        for (size_t i = 0; i < output_index.size(); i++)
+        {
+          if (output_index[i] != unused_index) physical[output_index[i]] = scratch_map.at(param_names[i]);
+        }
+      }
+
+      /** @brief Transform n points from unit hypercube to parameters, in structure-of-arrays layout: unit[d*n + k]
+                 is coordinate d of point k, and physical[j*n + k] is parameter j (in the order set by
+                 setOutputOrder) of point k.  This generic version goes through transform_array one point at a
+                 time; priors should override it with loops over the points that the compiler can vectorise. */
+      virtual void transform_batch(const double *unit, double *physical, size_t n) const
+      {
+        scratch_point.resize(size());
+        scratch_physical.resize(output_size);
+        for (size_t k = 0; k < n; k++)
+        {
+          for (size_t d = 0; d < scratch_point.size(); d++) scratch_point[d] = unit[d*n + k];
+          // Copy in the current values, as some priors depend on parameters set by others.
+          for (size_t j = 0; j < output_size; j++) scratch_physical[j] = physical[j*n + k];
+          transform_array(scratch_point.data(), scratch_physical.data());
+          for (size_t i = 0; i < output_index.size(); i++)
+          {
+            if (output_index[i] != unused_index) physical[output_index[i]*n + k] = scratch_physical[output_index[i]];
+          }
+        }
+      }
+
       /** @brief Log of PDF density */
       virtual double operator()(const std::vector<double> &) const
       {
@@ -18,6 +18,7 @@
 #define CHOLESKY_HPP
 
 #include <vector>
+#include <cstddef>
 #include <cmath>
 #include <iostream>
 namespace Gambit
@@ -70,17 +71,35 @@ namespace Gambit
         {
             int i, j;
             int num = el.size();
-            std::vector<double> b(num);
-            for(i = 0; i < num; i++)
+            // Work upwards from the last element, so that y can be overwritten in place.
+            for(i = num - 1; i >= 0; i--)
             {
-                b[i] = 0.0;
+                double b = 0.0;
                 for (j = 0; j <= i; j++)
                 {
-                    b[i] += el[i][j]*y[j];
+                    b += el[i][j]*y[j];
                 }
+                y[i] = b;
+            }
+        }
+
+        /// As ElMult, for n vectors in structure-of-arrays layout (element i of vector k in y[i*n + k]).
+        /// work must have space for n values.
+        void ElMult (double *y, size_t n, double *work) const
+        {
+            int i, j;
+            int num = el.size();
+            for(i = num - 1; i >= 0; i--)
+            {
+                for (size_t k = 0; k < n; k++) work[k] = 0.0;
+                for (j = 0; j <= i; j++)
+                {
+                    const double e = el[i][j];
+                    const double *yj = y + j*n;
+                    for (size_t k = 0; k < n; k++) work[k] += e*yj[k];
+                }
+                for (size_t k = 0; k < n; k++) y[i*n + k] = work[k];
             }
-            
-            y = b;
         }
 
         /**
@@ -30,7 +30,10 @@
 #define __FACTORY_DEFS_HPP__
 
 #include <string>
+#include <vector>
+#include <algorithm>
 #include <typeinfo>
+#include <limits>
 #ifdef __NO_PLUGIN_BOOST__
   #include <memory>
 #else
@@ -46,6 +49,7 @@
 #include "gambit/ScannerBit/scanner_utils.hpp"
 #include "gambit/ScannerBit/printer_interface.hpp"
 #include "gambit/ScannerBit/plugin_loader.hpp"
+#include "gambit/ScannerBit/prescreen.hpp"
 #include "gambit/Utils/signal_handling.hpp"
 
 namespace Gambit
@@ -94,6 +98,15 @@ namespace Gambit
             /// Variable to specify whether the scanner plugin should control the shutdown process
             bool _scanner_can_quit;
 
+            /// Lowest return value (before the purpose offset) that the scanner will accept
+            double lnlike_threshold;
+
+            /// Surrogate used to skip points that cannot reach lnlike_threshold (NULL if not requested)
+            Likelihood_Prescreen *prescreen;
+
+            /// Fidelity level at which the scanner wants the next points computed (-1 to leave it to the function)
+            int fidelity;
+
             virtual void deleter(Function_Base <ret (args...)> *in) const
             {
                 delete in;
@@ -102,7 +115,8 @@ namespace Gambit
             virtual const std::type_info & type() const {return typeid(ret (args...));}
 
         public:
-            Function_Base(double offset = 0.) : myRealRank(0), purpose_offset(offset), use_alternate_min_LogL(false), _scanner_can_quit(false)
+            Function_Base(double offset = 0.) : myRealRank(0), purpose_offset(offset), use_alternate_min_LogL(false), _scanner_can_quit(false),
+              lnlike_threshold(-std::numeric_limits<double>::infinity()), prescreen(NULL), fidelity(-1)
             {
                 #ifdef WITH_MPI
                 GMPI::Comm world;
@@ -125,6 +139,20 @@ namespace Gambit
 
             virtual double purposeModifier(double ret_val) {return ret_val;}
             virtual ret main(const args&...) = 0;
+            /// Estimated cost of re-evaluating the function when each parameter changes (empty if unknown).
+            virtual std::unordered_map<std::string, double> getParameterCosts() {return std::unordered_map<std::string, double>();}
+
+            /// Fix the order of the physical parameters passed to main_array.  Returns false if the function
+            /// can only be evaluated with main.
+            virtual bool setParameterOrder(const std::vector<std::string> &) {return false;}
+
+            /// Evaluate the function at the physical parameters given in the order fixed by setParameterOrder.
+            virtual ret main_array(const double *)
+            {
+                scan_err << "This function cannot be evaluated from an array of parameters." << scan_end;
+                return ret();
+            }
+
             virtual ~Function_Base(){}
 
             ret operator () (const args&... params)
@@ -140,9 +168,27 @@ namespace Gambit
                 return ret_val;
             }
 
+            /// As operator(), but calling main_array
+            ret call_array(const double *physical)
+            {
+                Gambit::Scanner::Plugins::plugin_info.set_calculating(true);
+                if(Gambit::Printers::auto_increment())
+                {
+                  ++Gambit::Printers::get_point_id();
+                }
+                ret ret_val = main_array(physical);
+                Gambit::Scanner::Plugins::plugin_info.set_calculating(false);
+
+                return ret_val;
+            }
+
             void setPurpose(const std::string p) {purpose = p;}
             void setPrinter(printer* p) {main_printer = p;}
             void setPrior(Priors::BasePrior *p) {prior = p;}
+            void setPrescreen(Likelihood_Prescreen *p) {prescreen = p;}
+            Likelihood_Prescreen *getPrescreen() {return prescreen;}
+            void setFidelity(int level) {fidelity = level;}
+            int getFidelity() const {return fidelity;}
             printer &getPrinter() {return *main_printer;}
             printer &getPrinter() const {return *main_printer;} // Need a const version as well.
             Priors::BasePrior &getPrior() {return *prior;}
@@ -215,6 +261,27 @@ namespace Gambit
                 }
                 return use_alternate_min_LogL;
             }
+
+            /// Tell the function that the scanner will reject any point with a return value (before the purpose
+            /// offset) below threshold, so that it may stop evaluating points that provably cannot reach it.
+            /// Called by e.g. the MultiNest plugin with the lowest likelihood of the live points.
+            void setLnLikeThreshold(double threshold)
+            {
+                lnlike_threshold = threshold;
+                #ifdef WITH_MPI
+                    Gambit::Scanner::Plugins::plugin_info.send_lnlike_threshold(threshold);
+                #endif
+            }
+
+            /// Get the lowest return value that the scanner will accept, including any update from another process
+            /// (minus infinity if the scanner has not set one)
+            double getLnLikeThreshold()
+            {
+                #ifdef WITH_MPI
+                    Gambit::Scanner::Plugins::plugin_info.recv_lnlike_threshold(lnlike_threshold);
+                #endif
+                return lnlike_threshold;
+            }
             /// @}
 
        };
@@ -319,11 +386,114 @@ namespace Gambit
             typedef scan_ptr<double (std::unordered_map<std::string, double> &)> s_ptr;
             std::unordered_map<std::string, double> map;
 
+            /// Unit hypercube and physical parameters of the current point, for the array call path
+            std::vector<double> unit_cube, physical;
+
+            /// Names of the physical parameters, in the order of physical
+            std::vector<std::string> param_names;
+
+            /// Has the call plan been made, and does the function take parameters as an array?
+            bool planned, use_array;
+
+            /// Labels and printer IDs of the quantities printed at every point
+            std::string purpose_label, modified_label;
+            int purpose_id, modified_id, unitcube_id, pointid_id, rank_id, vetoed_id, prediction_id, vetoed_params_id;
+
+            /// Was the current point passed to the surrogate pre-screening?
+            bool screened;
+
+            /// Fix the order of the physical parameters and the printer IDs, so that every later point can be
+            /// evaluated and printed without string lookups or allocations.
+            void plan()
+            {
+                param_names = (*this)->getParameters();
+                (*this)->getPrior().setOutputOrder(param_names);
+                physical.assign(param_names.size(), 0.);
+                use_array = (*this)->setParameterOrder(param_names);
+                purpose_label = (*this)->getPurpose();
+                modified_label = "Modified" + purpose_label;
+                purpose_id = Gambit::Printers::get_param_id(purpose_label);
+                modified_id = Gambit::Printers::get_param_id(modified_label);
+                unitcube_id = Gambit::Printers::get_param_id("unitCubeParameters");
+                pointid_id = Gambit::Printers::get_param_id("pointID");
+                rank_id = Gambit::Printers::get_param_id("MPIrank");
+                vetoed_id = Gambit::Printers::get_param_id("PrescreenVetoed");
+                prediction_id = Gambit::Printers::get_param_id("PrescreenPrediction");
+                vetoed_params_id = Gambit::Printers::get_param_id("PrescreenParameters");
+                planned = true;
+            }
+
+            /// Ask the surrogate pre-screening, if any, whether to skip the point in the unit hypercube.  A skipped
+            /// point is treated like an invalid one: ret_val is set to the (alternate, if in use) min_LogL.  It gets
+            /// a new point ID, and its physical parameters are printed here as the function does not see it.
+            bool prescreen_veto(const std::vector<double> &vec, double &ret_val)
+            {
+                Likelihood_Prescreen *screen = (*this)->getPrescreen();
+                screened = (screen != NULL and vec.size() == (*this)->getPrior().size());
+                if (not screened or not screen->veto(vec, (*this)->getLnLikeThreshold()))
+                    return false;
+
+                ret_val = screen->vetoed_value((*this)->check_for_switch_to_alternate_min_LogL());
+
+                if (Gambit::Printers::auto_increment())
+                {
+                    ++Gambit::Printers::get_point_id();
+                }
+                static const std::string vetoed_params_label("PrescreenParameters");
+                (*this)->getPrior().transform(vec, map);
+                map_str_dbl params(map.begin(), map.end());
+                (*this)->getPrinter().print(params, vetoed_params_label, vetoed_params_id, (*this)->getRank(), Gambit::Printers::get_point_id());
+                return true;
+            }
+
+            /// Add an evaluated point to the training set of the surrogate pre-screening, if any.  The surrogate
+            /// learns the value after the purpose modifier, as that is what the scanner's threshold applies to.
+            void prescreen_learn(const std::vector<double> &vec, double ret_val)
+            {
+                if (screened and not Gambit::Scanner::Plugins::plugin_info.early_shutdown_in_progress())
+                {
+                    (*this)->getPrescreen()->learn(vec, (*this)->purposeModifier(ret_val));
+                }
+            }
+
+            /// Print the function value and point details, and return the offset value for the scanner.  The function
+            /// value is not printed for points skipped by the pre-screening, so that they are marked invalid.
+            double finish_point(double ret_val, const std::vector<double> &vec)
+            {
+                int rank = (*this)->getRank();
+                double modified_ret_val = (*this)->purposeModifier(ret_val);
+                unsigned long long int id = Gambit::Printers::get_point_id();
+                static const std::string unitcube_label("unitCubeParameters"), pointid_label("pointID"), rank_label("MPIrank");
+                printer &p = (*this)->getPrinter();
+                if (not (screened and (*this)->getPrescreen()->vetoed()))
+                {
+                    p.print(ret_val, purpose_label, purpose_id, rank, id);
+                    p.print(modified_ret_val, modified_label, modified_id, rank, id);
+                }
+                if (vec.size() > 0 && p.get_printUnitcube())
+                {
+                  p.print(vec, unitcube_label, unitcube_id, rank, id);
+                }
+                p.print(id,   pointid_label, pointid_id, rank, id);
+                p.print(rank, rank_label, rank_id, rank, id);
+                if (screened)
+                {
+                    static const std::string vetoed_label("PrescreenVetoed"), prediction_label("PrescreenPrediction");
+                    Likelihood_Prescreen *screen = (*this)->getPrescreen();
+                    p.print(int(screen->vetoed()), vetoed_label, vetoed_id, rank, id);
+                    if (screen->predicted()) p.print(screen->prediction(), prediction_label, prediction_id, rank, id);
+                }
+                p.enable(); // Make sure printer is re-enabled (might have been disabled by invalid point error)
+
+                // Return the value of the function, offset by any offset set
+                return modified_ret_val + (*this)->getPurposeOffset();
+            }
+
         public:
-            like_ptr(){}
-            like_ptr(const like_ptr &in) : s_ptr (in){}
+            like_ptr() : planned(false), use_array(false), screened(false) {}
+            like_ptr(const like_ptr &in) : s_ptr (in), planned(false), use_array(false), screened(false) {}
             //like_ptr(like_ptr &&in) : s_ptr (std::move(in)) {}
-            like_ptr(void *in) : s_ptr(in) {}
+            like_ptr(void *in) : s_ptr(in), planned(false), use_array(false), screened(false) {}
 
             std::unordered_map<std::string, double> transform(const std::vector<double> &vec)
             {
@@ -341,46 +511,155 @@ namespace Gambit
                 return (*this)->getPrior().inverse_transform(physical);
             }
 
-            double operator()(const std::vector<double> &vec)
+            /// Names of all the physical parameters, in the order used by transform_batch
+            std::vector<std::string> get_all_names() const
             {
-                int rank = (*this)->getRank();
-                (*this)->getPrior().transform(vec, map);
-                double ret_val = (*this)->operator()(map);
-                double modified_ret_val = (*this)->purposeModifier(ret_val);
-                unsigned long long int id = Gambit::Printers::get_point_id();
-                (*this)->getPrinter().print(ret_val, (*this)->getPurpose(), rank, id);
-                (*this)->getPrinter().print(modified_ret_val, "Modified" + (*this)->getPurpose(), rank, id);
-                if (vec.size() > 0 && (*this)->getPrinter().get_printUnitcube())
+              return (*this)->getPrior().getParameters();
+            }
+
+            /// Transform n points from the unit hypercube to physical parameters, in structure-of-arrays layout (see
+            /// Priors::BasePrior::transform_batch).  physical must have space for n values of each of get_all_names().
+            /// The points can then be evaluated one by one with evaluate_transformed.
+            void transform_batch(const double *unit, double *physical, size_t n)
+            {
+                if (not planned) plan();
+                (*this)->getPrior().transform_batch(unit, physical, n);
+            }
+
+            /// Evaluate the function at a point whose physical parameters were computed by transform_batch.  unit holds
+            /// the point in the unit hypercube (one entry per dimension of the prior), and physical_batch points at the
+            /// point's first parameter in the output of transform_batch, whose other parameters are stride (the number
+            /// of points in the batch) entries apart.
+            double evaluate_transformed(const double *unit, const double *physical_batch, size_t stride)
+            {
+                if (not planned) plan();
+                unit_cube.assign(unit, unit + (*this)->getPrior().size());
+                double ret_val;
+                if (prescreen_veto(unit_cube, ret_val))
+                {
+                    return finish_point(ret_val, unit_cube);
+                }
+                for (size_t j = 0; j < physical.size(); j++) physical[j] = physical_batch[j*stride];
+                if (use_array)
                 {
-                  (*this)->getPrinter().print(vec, "unitCubeParameters", rank, id);
+                    ret_val = (*this)->call_array(physical.data());
                 }
-                (*this)->getPrinter().print(id,   "pointID", rank, id);
-                (*this)->getPrinter().print(rank, "MPIrank", rank, id);
-                (*this)->getPrinter().enable(); // Make sure printer is re-enabled (might have been disabled by invalid point error)
+                else
+                {
+                    for (size_t j = 0; j < physical.size(); j++) map[param_names[j]] = physical[j];
+                    ret_val = (*this)->operator()(map);
+                }
+                prescreen_learn(unit_cube, ret_val);
+                return finish_point(ret_val, unit_cube);
+            }
 
-                // Return the value of the function, offset by any offset set
-                return modified_ret_val + (*this)->getPurposeOffset();
+            /// Estimated cost of re-evaluating the function when each of the shown parameters changes, in the
+            /// same order as get_names().  All zero if the function does not provide estimates.
+            std::vector<double> get_parameter_costs()
+            {
+                std::vector<std::string> names = get_names();
+                std::unordered_map<std::string, double> costs = (*this)->getParameterCosts();
+                std::vector<double> result(names.size(), 0.0);
+                for (size_t i = 0; i < names.size(); i++)
+                {
+                    auto it = costs.find(names[i]);
+                    if (it != costs.end()) result[i] = it->second;
+                }
+                #ifdef WITH_MPI
+                    // Timings differ between processes, so use those of the master to keep the grading consistent.
+                    GMPI::Comm& myComm(Gambit::Scanner::Plugins::plugin_info.scanComm());
+                    if (not result.empty()) myComm.Bcast(result, result.size(), 0);
+                #endif
+                return result;
+            }
+
+            /// Tell the function that the scanner will reject any point for which operator() returns less than
+            /// threshold.  The function may then return any value below threshold for such points, without
+            /// computing all of its components.
+            void set_lnlike_threshold(double threshold)
+            {
+                (*this)->setLnLikeThreshold(threshold - (*this)->getPurposeOffset());
+            }
+
+            /// Ask for the next points to be computed at the given fidelity level, from 0 (cheapest) to the number of
+            /// levels set in the likelihood options minus 1 (full accuracy), or -1 to leave the choice to the function.
+            void set_fidelity(int level)
+            {
+                (*this)->setFidelity(level);
+            }
+
+            /// Group the shown parameters into grades of similar cost, slowest first.  A new grade is started
+            /// whenever a parameter is cheaper than the slowest one in the current grade by more than speed_ratio.
+            std::vector<std::vector<std::string>> get_speed_hierarchy(double speed_ratio = 10.)
+            {
+                std::vector<std::string> names = get_names();
+                std::vector<double> costs = get_parameter_costs();
+                std::vector<size_t> order(names.size());
+                for (size_t i = 0; i < order.size(); i++) order[i] = i;
+                std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return costs[a] > costs[b]; });
+
+                std::vector<std::vector<std::string>> grades;
+                double grade_cost = 0.;
+                for (size_t i : order)
+                {
+                    if (grades.empty() or costs[i]*speed_ratio < grade_cost)
+                    {
+                        grades.emplace_back();
+                        grade_cost = costs[i];
+                    }
+                    grades.back().push_back(names[i]);
+                }
+                return grades;
+            }
+
+            /// Evaluate the function at a point in the unit hypercube, given as a contiguous array with one entry
+            /// per dimension of the prior.  If the function supports it, the physical parameters are passed on as an
+            /// array with indices fixed at the first call, rather than as a map.
+            double operator()(const double *unit)
+            {
+                if (not planned) plan();
+                unit_cube.assign(unit, unit + (*this)->getPrior().size());
+                double ret_val;
+                if (prescreen_veto(unit_cube, ret_val))
+                {
+                    return finish_point(ret_val, unit_cube);
+                }
+                if (use_array)
+                {
+                    (*this)->getPrior().transform_array(unit_cube.data(), physical.data());
+                    ret_val = (*this)->call_array(physical.data());
+                }
+                else
+                {
+                    (*this)->getPrior().transform(unit_cube, map);
+                    ret_val = (*this)->operator()(map);
+                }
+                prescreen_learn(unit_cube, ret_val);
+                return finish_point(ret_val, unit_cube);
+            }
+
+            double operator()(const std::vector<double> &vec)
+            {
+                if (vec.size() < (*this)->getPrior().size())
+                {
+                    scan_err << "Point in the unit hypercube has " << vec.size() << " entries, but the prior has "
+                             << (*this)->getPrior().size() << " dimensions." << scan_end;
+                }
+                return operator()(vec.data());
             }
 
             double operator()(std::unordered_map<std::string, double> &map, const std::vector<double> &vec = std::vector<double>())
             {
-                int rank = (*this)->getRank();
+                if (not planned) plan();
                 (*this)->getPrior().transform(vec, map);
-                double ret_val = (*this)->operator()(map);
-                double modified_ret_val = (*this)->purposeModifier(ret_val);
-                unsigned long long int id = Gambit::Printers::get_point_id();
-                (*this)->getPrinter().print(ret_val, (*this)->getPurpose(), rank, id);
-                (*this)->getPrinter().print(modified_ret_val, "Modified" + (*this)->getPurpose(), rank, id);
-                if (vec.size() > 0 && (*this)->getPrinter().get_printUnitcube())
+                double ret_val;
+                if (prescreen_veto(vec, ret_val))
                 {
-                  (*this)->getPrinter().print(vec, "unitCubeParameters", rank, id);
+                    return finish_point(ret_val, vec);
                 }
-                (*this)->getPrinter().print(id,   "pointID", rank, id);
-                (*this)->getPrinter().print(rank, "MPIrank", rank, id);
-                (*this)->getPrinter().enable(); // Make sure printer is re-enabled (might have been disabled by invalid point error)
-
-                // Return the value of the function, offset by any offset set
-                return modified_ret_val + (*this)->getPurposeOffset();
+                ret_val = (*this)->operator()(map);
+                prescreen_learn(vec, ret_val);
+                return finish_point(ret_val, vec);
             }
         };
 
@@ -47,6 +47,8 @@ namespace Gambit
 
     namespace Scanner
     {
+        /// Forward declare surrogate pre-screening class
+        class Likelihood_Prescreen;
 
         namespace Plugins
         {
@@ -149,7 +151,14 @@ namespace Gambit
                 #ifdef WITH_MPI
                 GMPI::Comm* scannerComm;
                 bool MPIdata_is_init;
+                /// Last lnlike threshold sent to each process, and the request of that send
+                std::vector<double> threshold_msgs;
+                std::vector<MPI_Request> threshold_requests;
+                /// Number of lnlike threshold messages sent to and received from each process
+                std::vector<int> thresholds_sent;
+                std::vector<int> thresholds_received;
                 #endif
+                std::map<std::string, Likelihood_Prescreen *> prescreens;
                 /// Flag to indicate if early shutdown is in progess (e.g. due to intercepted OS signal). When set to 'true' scanners should at minimum close off their output files, and if possible they should stop scanning and return control to GAMBIT (or whatever the host code might be).
                 bool earlyShutdownInProgress;
 
@@ -197,9 +206,18 @@ namespace Gambit
                 #ifdef WITH_MPI
                 // tags for messages sent via scannerComm
                 static const int MIN_LOGL_MSG = 0;
+                static const int LNLIKE_THRESHOLD_MSG = 1;
                 ///Initialise any MPI functionality (currently just used to provide a communicator object to ScannerBit)
                 void initMPIdata(GMPI::Comm* newcomm);
                 GMPI::Comm& scanComm();
+                ///Send an lnlike threshold to all other processes.  A process whose previous message is still in
+                ///flight is skipped, and will get a later threshold instead.
+                void send_lnlike_threshold(double);
+                ///Receive any lnlike thresholds sent by other processes.  Returns false if there were none, and
+                ///otherwise sets the argument to the last one received.
+                bool recv_lnlike_threshold(double &);
+                ///Receive all lnlike threshold messages still in flight and complete all sends (COLLECTIVE OPERATION)
+                void finish_lnlike_threshold_messages();
                 #endif
                 int getRank() { return MPIrank; }
 
@@ -229,6 +247,12 @@ namespace Gambit
                     set_resume(resume_data[name], data...);
                 }
 
+                ///Surrogate pre-screening of the given purpose, if requested in the inifile (NULL otherwise)
+                Likelihood_Prescreen *prescreen(const std::string &);
+
+                ///Write the calibration reports of the surrogate pre-screening
+                void prescreen_report();
+
                 ///Dump contents for resume.
                 void dump();
 
@@ -0,0 +1,111 @@
+//  GAMBIT: Global and Modular BSM Inference Tool
+//  *********************************************
+///  \file
+///
+///  Surrogate pre-screening of expensive
+///  objective functions, for any scanner plugin.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#ifndef __PRESCREEN_HPP__
+#define __PRESCREEN_HPP__
+
+#include <string>
+#include <vector>
+#include <deque>
+
+#include "gambit/Utils/yaml_options.hpp"
+#include "gambit/Utils/util_macros.hpp"
+
+namespace Gambit
+{
+
+    namespace Scanner
+    {
+
+        /// Gaussian process model of an objective function on the unit hypercube, trained online from the
+        /// points that have been evaluated.  Points whose predicted value is confidently below the lowest value
+        /// the scanner will accept are not evaluated, except for a random fraction that is used to check the
+        /// model.
+        class EXPORT_SYMBOLS Likelihood_Prescreen
+        {
+        private:
+            std::string purpose;
+
+            /// Options
+            /// @{
+            size_t max_train, min_train, refit_interval;
+            double delta_lnlike, nsigma, fallback_rate;
+            /// @}
+
+            /// Values returned for skipped points, as for points found to be invalid
+            double min_LogL, alt_min_LogL;
+
+            /// Evaluated points and their values, most recent last
+            std::deque<std::vector<double>> train_x;
+            std::deque<double> train_y;
+            double best;
+            size_t new_points;
+
+            /// The fitted model: points, lower Cholesky factor of the kernel matrix (row-major) and weights,
+            /// for unit signal variance and the values standardised with mean and scale.
+            std::vector<std::vector<double>> fit_x;
+            std::vector<double> chol, alpha;
+            double mean, scale, length, noise;
+            size_t nfits;
+
+            /// The current point
+            /// @{
+            bool has_prediction, is_vetoed, is_audit;
+            double pred_mean, pred_sd, cut;
+            /// @}
+
+            /// Calibration statistics
+            /// @{
+            unsigned long long n_screened, n_vetoed, n_audits, n_false_vetoes, n_compared, n_within_1sigma, n_covered;
+            double sum_z, sum_z2;
+            /// @}
+
+            /// Fit the model to the training set
+            void fit();
+
+            /// Predict the mean and standard deviation of the objective at x
+            void predict(const std::vector<double> &x, double &m, double &sd) const;
+
+        public:
+            Likelihood_Prescreen(const Options &options, const std::string &purpose, double min_LogL, double alt_min_LogL);
+
+            /// Decide whether to skip the evaluation of the point in the unit hypercube, given the lowest value that
+            /// the scanner will accept (minus infinity if it has not set one).  Values passed to learn must be in the
+            /// same units as the threshold, i.e. after any purpose modifier.
+            bool veto(const std::vector<double> &unit, double threshold);
+
+            /// Value to return for a skipped point: the lowest valid value of the objective, or its alternate.
+            double vetoed_value(bool alternate) const {return alternate ? alt_min_LogL : min_LogL;}
+
+            /// Add the value of the last point passed to veto, which has been evaluated, to the training set.
+            void learn(const std::vector<double> &unit, double value);
+
+            /// Details of the last point passed to veto
+            /// @{
+            bool vetoed() const {return is_vetoed;}
+            bool predicted() const {return has_prediction;}
+            double prediction() const {return pred_mean;}
+            /// @}
+
+            /// Write the calibration report to the given file, and a summary to stdout.
+            void report(const std::string &filename, int rank) const;
+        };
+
+    }
+
+}
+
+#endif
@@ -79,6 +79,43 @@ namespace Gambit {
         }
       }
 
+      void transform_array(const double *unit, double *physical) const override
+      {
+        scratch_unit.resize(size());
+        for (size_t i = 0; i < scratch_unit.size(); i++)
+        {
+          scratch_unit[i] = std::tan(M_PI * (unit[i] - 0.5));
+        }
+
+        col.ElMult(scratch_unit);
+
+        for (size_t i = 0; i < output_index.size(); i++)
+        {
+          if (output_index[i] != unused_index) physical[output_index[i]] = scratch_unit[i] + location[i];
+        }
+      }
+
+      void transform_batch(const double *unit, double *physical, size_t n) const override
+      {
+        const size_t dim = size();
+        scratch_unit.resize(dim*n);
+        scratch_point.resize(n);
+        for (size_t k = 0; k < dim*n; k++)
+        {
+          scratch_unit[k] = std::tan(M_PI * (unit[k] - 0.5));
+        }
+
+        col.ElMult(scratch_unit.data(), n, scratch_point.data());
+
+        for (size_t i = 0; i < output_index.size(); i++)
+        {
+          if (output_index[i] == unused_index) continue;
+          const double *z = scratch_unit.data() + i*n;
+          double *out = physical + output_index[i]*n;
+          for (size_t k = 0; k < n; k++) out[k] = z[k] + location[i];
+        }
+      }
+
       std::vector<double> inverse_transform(const std::unordered_map<std::string, double> &physical) const override
       {
         // subtract location
@@ -74,6 +74,36 @@ namespace Gambit
                 }
             }
 
+            // Pass the output order on to the component priors
+            void setOutputOrder(const std::vector<std::string> &names) override
+            {
+                BasePrior::setOutputOrder(names);
+                for (auto it = my_subpriors.begin(), end = my_subpriors.end(); it != end; it++)
+                {
+                    (*it)->setOutputOrder(names);
+                }
+            }
+
+            // Transformation from unit hypercube to an array of physical parameters
+            void transform_array(const double *unit, double *physical) const override
+            {
+                for (auto it = my_subpriors.begin(), end = my_subpriors.end(); it != end; it++)
+                {
+                    (*it)->transform_array(unit, physical);
+                    unit += (*it)->size();
+                }
+            }
+
+            // Transformation of a batch of points from unit hypercube to physical parameters
+            void transform_batch(const double *unit, double *physical, size_t n) const override
+            {
+                for (auto it = my_subpriors.begin(), end = my_subpriors.end(); it != end; it++)
+                {
+                    (*it)->transform_batch(unit, physical, n);
+                    unit += (*it)->size()*n;
+                }
+            }
+
             // Transformation from physical parameters back to unit hypercube
             std::vector<double> inverse_transform(const std::unordered_map<std::string, double> &physical) const override
             {
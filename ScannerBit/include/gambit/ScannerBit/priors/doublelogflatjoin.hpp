@@ -60,12 +60,17 @@ namespace Gambit
          /// Try to get options for double log-flat joined prior
          double get_option(const str&, const Options&);
 
+         /// Transformation of a single unit cube value
+         double transform_value(double r) const;
+
       public: 
          /// Constructor defined in doublelogflatjoin.cpp
          DoubleLogFlatJoin(const std::vector<std::string>& param, const Options&); 
 
          /// Transformation from unit interval to the double log + flat join (inverse prior transform)
          void transform(const std::vector <double> &unitpars, std::unordered_map <std::string, double> &output) const;
+         void transform_array(const double *unit, double *physical) const override;
+         void transform_batch(const double *unit, double *physical, size_t n) const override;
          std::vector<double> inverse_transform(const std::unordered_map<std::string, double> &) const override;
 
          /// Probability density function
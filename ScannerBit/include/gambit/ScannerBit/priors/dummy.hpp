@@ -45,6 +45,22 @@ namespace Gambit
                 }
             }
 
+            void transform_array(const double *unit, double *physical) const override
+            {
+                for (size_t i = 0; i < output_index.size(); i++)
+                {
+                    if (output_index[i] != unused_index) physical[output_index[i]] = unit[i];
+                }
+            }
+
+            void transform_batch(const double *unit, double *physical, size_t n) const override
+            {
+                for (size_t i = 0; i < output_index.size(); i++)
+                {
+                    if (output_index[i] != unused_index) std::copy(unit + i*n, unit + (i+1)*n, physical + output_index[i]*n);
+                }
+            }
+
             std::vector<double> inverse_transform(const std::unordered_map<std::string, double> &physical) const override
             {
                 std::vector<double> u;
@@ -79,6 +95,13 @@ namespace Gambit
                 }
             }
 
+            void transform_array(const double *, double *) const override
+            {
+                scan_err << "Parameter " << param_names[0] << " prior is specified as 'none',"
+                         << " which needs the scanner to input its value in a map."
+                         << scan_end;
+            }
+
             std::vector<double> inverse_transform(const std::unordered_map<std::string, double> &) const override
             {
               scan_err << "'None' prior has no inverse transform" << scan_end;
@@ -87,6 +87,28 @@ namespace Gambit
                 iter = (iter + 1)%value.size();
             }
 
+            void transform_array(const double *, double *physical) const override
+            {
+                for (size_t i = 0; i < output_index.size(); i++)
+                {
+                    if (output_index[i] != unused_index) physical[output_index[i]] = value[iter];
+                }
+
+                iter = (iter + 1)%value.size();
+            }
+
+            void transform_batch(const double *, double *physical, size_t n) const override
+            {
+                for (size_t i = 0; i < output_index.size(); i++)
+                {
+                    if (output_index[i] == unused_index) continue;
+                    double *out = physical + output_index[i]*n;
+                    for (size_t k = 0; k < n; k++) out[k] = value[(iter + k)%value.size()];
+                }
+
+                iter = (iter + n)%value.size();
+            }
+
             std::vector<double> inverse_transform(const std::unordered_map<std::string, double> &physical) const override
             {
                 const double rtol = 1e-4;
@@ -112,10 +134,11 @@ namespace Gambit
         private:
             std::string name;
             std::vector<double> scale, shift;
+            size_t name_index;
 
         public:
             MultiPriors(const std::vector<std::string>& param, const Options& options) :
-                BasePrior(param), scale(param.size(), 1.0), shift(param.size(), 0.0)
+                BasePrior(param), scale(param.size(), 1.0), shift(param.size(), 0.0), name_index(unused_index)
             {
                 if (options.hasKey("same_as"))
                 {
@@ -138,7 +161,7 @@ namespace Gambit
                 }
             }
 
-            MultiPriors(std::string name_in, std::unordered_map<std::string, std::pair<double, double> > &map_in)
+            MultiPriors(std::string name_in, std::unordered_map<std::string, std::pair<double, double> > &map_in) : name_index(unused_index)
             {
                 std::string::size_type pos_old = 0;
                 std::string::size_type pos = name_in.find("+");
@@ -177,6 +200,43 @@ namespace Gambit
                 }
             }
 
+            void setOutputOrder(const std::vector<std::string> &names) override
+            {
+                BasePrior::setOutputOrder(names);
+                auto it = std::find(names.begin(), names.end(), name);
+                name_index = (it == names.end() ? size_t(unused_index) : it - names.begin());
+            }
+
+            void transform_array(const double *, double *physical) const override
+            {
+                if (name_index == unused_index)
+                {
+                    scan_err << "same_as:  " << name << " is not in the output of the array transform." << scan_end;
+                }
+                double value = physical[name_index];
+
+                for (size_t i = 0; i < output_index.size(); i++)
+                {
+                    if (output_index[i] != unused_index) physical[output_index[i]] = scale[i]*value + shift[i];
+                }
+            }
+
+            void transform_batch(const double *, double *physical, size_t n) const override
+            {
+                if (name_index == unused_index)
+                {
+                    scan_err << "same_as:  " << name << " is not in the output of the array transform." << scan_end;
+                }
+                const double *value = physical + name_index*n;
+
+                for (size_t i = 0; i < output_index.size(); i++)
+                {
+                    if (output_index[i] == unused_index) continue;
+                    double *out = physical + output_index[i]*n;
+                    for (size_t k = 0; k < n; k++) out[k] = scale[i]*value[k] + shift[i];
+                }
+            }
+
             std::vector<double> inverse_transform(const std::unordered_map<std::string, double> &physical) const override
             {
                 const double rtol = 1e-4;
@@ -219,6 +219,21 @@ namespace Gambit
                 output[myparameter] = (T::inv(unitpars[0]*(upper-lower) + lower)-shift_out)/scale_out;
             }
 
+            void transform_array(const double *unit, double *physical) const override
+            {
+                if (output_index[0] != unused_index) physical[output_index[0]] = (T::inv(unit[0]*(upper-lower) + lower)-shift_out)/scale_out;
+            }
+
+            void transform_batch(const double *unit, double *physical, size_t n) const override
+            {
+                if (output_index[0] == unused_index) return;
+                double *out = physical + output_index[0]*n;
+                for (size_t k = 0; k < n; k++)
+                {
+                    out[k] = (T::inv(unit[k]*(upper-lower) + lower)-shift_out)/scale_out;
+                }
+            }
+
             std::vector<double> inverse_transform(const std::unordered_map<std::string, double> &physical) const override
             {
                 const double p = physical.at(myparameter);
@@ -84,6 +84,43 @@ namespace Gambit
         }
       }
 
+      void transform_array(const double *unit, double *physical) const override
+      {
+        scratch_unit.resize(size());
+        for (size_t i = 0; i < scratch_unit.size(); i++)
+        {
+          scratch_unit[i] = M_SQRT2 * boost::math::erf_inv(2. * unit[i] - 1.);
+        }
+
+        col.ElMult(scratch_unit);
+
+        for (size_t i = 0; i < output_index.size(); i++)
+        {
+          if (output_index[i] != unused_index) physical[output_index[i]] = std::pow(base, scratch_unit[i] + mu[i]);
+        }
+      }
+
+      void transform_batch(const double *unit, double *physical, size_t n) const override
+      {
+        const size_t dim = size();
+        scratch_unit.resize(dim*n);
+        scratch_point.resize(n);
+        for (size_t k = 0; k < dim*n; k++)
+        {
+          scratch_unit[k] = M_SQRT2 * boost::math::erf_inv(2. * unit[k] - 1.);
+        }
+
+        col.ElMult(scratch_unit.data(), n, scratch_point.data());
+
+        for (size_t i = 0; i < output_index.size(); i++)
+        {
+          if (output_index[i] == unused_index) continue;
+          const double *z = scratch_unit.data() + i*n;
+          double *out = physical + output_index[i]*n;
+          for (size_t k = 0; k < n; k++) out[k] = std::pow(base, z[k] + mu[i]);
+        }
+      }
+
       std::vector<double> inverse_transform(const std::unordered_map<std::string, double> &physical) const override
       {
         // undo exponentiation
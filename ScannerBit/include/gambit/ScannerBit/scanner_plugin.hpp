@@ -51,7 +51,12 @@ void *get_purpose(const std::string &purpose)
     static_cast <Function_Base<void(void)>*>(ptr)->setPurpose(purpose);                     \
     static_cast <Function_Base<void(void)>*>(ptr)->setPrinter(get_printer().get_stream());  \
     static_cast <Function_Base<void(void)>*>(ptr)->setPrior(&get_prior());                  \
+    static_cast <Function_Base<void(void)>*>(ptr)->setPrescreen(                            \
+        Gambit::Scanner::Plugins::plugin_info.prescreen(purpose));                          \
     assign_aux_numbers(purpose, "pointID", "MPIrank");                                      \
+    if (Gambit::Scanner::Plugins::plugin_info.prescreen(purpose) != NULL)                   \
+        assign_aux_numbers("PrescreenVetoed", "PrescreenPrediction",                        \
+                           "PrescreenParameters");                                          \
                                                                                             \
     return ptr;                                                                             \
 }                                                                                           \
@@ -0,0 +1,58 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Affine-invariant ensemble sampler
+///  (Goodman & Weare 2010, stretch move), with
+///  the parallel half-ensemble update of
+///  Foreman-Mackey et al. 2013.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#ifndef ENSEMBLE_HPP
+#define ENSEMBLE_HPP
+
+#include <vector>
+
+#include "scanner_plugin.hpp"
+
+namespace Gambit
+{
+
+    namespace Scanner
+    {
+
+        /// Is any coordinate of the point outside the unit hypercube?
+        inline bool outsideUnitCube(const std::vector<double> &in)
+        {
+            for (auto it = in.begin(), end = in.end(); it != end; ++it)
+            {
+                if (not (*it >= 0.0 and *it <= 1.0)) return true;
+            }
+
+            return false;
+        }
+
+        void AffineEnsemble(Gambit::Scanner::like_ptr LogLike,
+                            Gambit::Scanner::printer_interface &printer,
+                            Gambit::Scanner::resume_params_func set_resume_params,
+                            const int &dimension,
+                            const int &nwalkers,
+                            const double &stretch,
+                            const long long &nsteps,
+                            const long long &seed,
+                            const int &save_freq,
+                            const double &mins_max);
+
+    }
+
+}
+
+#endif
@@ -66,9 +66,12 @@ namespace Gambit
             /// Variable to indicate whether the dumper function has been run at least once
             bool dumper_runonce;
 
+            /// Variable to indicate whether to pass the lowest live point likelihood on to the likelihood function
+            bool use_lnlike_threshold;
+
          public:
             /// Constructor
-            LogLikeWrapper(scanPtr, printer_interface&);
+            LogLikeWrapper(scanPtr, printer_interface&, bool use_lnlike_threshold = false);
 
             /// Main interface function from MultiNest to ScannerBit-supplied loglikelihood function
             double LogLike(double*, int, int);
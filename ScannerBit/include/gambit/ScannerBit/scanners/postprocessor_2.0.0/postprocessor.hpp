@@ -37,7 +37,8 @@ namespace Gambit
       /// @{ Helper functions for performing resume related tasks
 
       /// Answer queries as to whether a given dataset index has been postprocessed in a previous run or not
-      bool point_done(const ChunkSet done_chunks, size_t index);
+      /// (done_chunks must not overlap, as guaranteed by merge_chunks)
+      bool point_done(const ChunkSet& done_chunks, size_t index);
 
       /// Get 'effective' start and end positions for a processing batch
       /// i.e. simply divides up an integer into the most even parts possible
@@ -87,6 +88,7 @@ namespace Gambit
          unsigned int numtasks;
          unsigned int rank;
          std::size_t chunksize;
+         std::size_t max_chunksize;
          #ifdef WITH_MPI
          GMPI::Comm* comm;
          PPOptions() : comm(NULL) {}
@@ -141,8 +143,12 @@ namespace Gambit
             /// Next point scheduled to be distributed for processing
             unsigned long long next_point;
 
-            /// Size of chunks to distribute to worker processes
+            /// Smallest and largest sizes of chunks to distribute to worker processes
             unsigned long long chunksize;
+            unsigned long long max_chunksize;
+
+            /// Number of points not yet distributed that still need processing
+            unsigned long long remaining_points;
 
             /// Chunks describing the points that can be auto-skipped (because they have been processed previously)
             ChunkSet done_chunks;
@@ -192,6 +198,7 @@ namespace Gambit
 
             /// MPI variables (set manually rather than inferred, to allow for "virtual rank" settings
             unsigned int rank;
+            unsigned int numtasks;
             #ifdef WITH_MPI
               GMPI::Comm* comm;
             #endif
@@ -0,0 +1,230 @@
+//  GAMBIT: Global and Modular BSM Inference Tool
+//  *********************************************
+///  \file
+///
+///  Space-filling point sets on the unit
+///  hypercube, for the sobol and latin_hypercube
+///  scanners.  Any point of either set can be
+///  computed directly from its index, so that
+///  processes can share out a set without
+///  communicating, and a scan can resume from any
+///  index.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#ifndef LOW_DISCREPANCY_HPP
+#define LOW_DISCREPANCY_HPP
+
+#include <vector>
+#include <random>
+
+namespace Gambit
+{
+
+    namespace Scanner
+    {
+
+        /// Mixes the bits of x (splitmix64 finaliser)
+        inline unsigned long long hash64(unsigned long long x)
+        {
+            x += 0x9e3779b97f4a7c15ULL;
+            x = (x ^ (x >> 30))*0xbf58476d1ce4e5b9ULL;
+            x = (x ^ (x >> 27))*0x94d049bb133111ebULL;
+            return x ^ (x >> 31);
+        }
+
+        /// Uniform number in [0, 1) for index i of the stream chosen by seed
+        inline double hash_uniform(unsigned long long i, unsigned long long seed)
+        {
+            return (hash64(i ^ hash64(seed)) >> 11)*(1.0/9007199254740992.0);
+        }
+
+        /// Image of i under a pseudo-random permutation of 0 ... n-1 chosen by seed.  Each step below is
+        /// invertible on the lowest bits up to the next power of two, and values outside [0, n) are mapped
+        /// again until they fall inside (cycle walking), so no table is needed.
+        inline unsigned int hash_permute(unsigned int i, unsigned int n, unsigned int seed)
+        {
+            unsigned int w = n - 1;
+            w |= w >> 1; w |= w >> 2; w |= w >> 4; w |= w >> 8; w |= w >> 16;
+            do
+            {
+                i ^= seed;             i *= 0xe170893du;
+                i ^= seed >> 16;
+                i ^= (i & w) >> 4;
+                i ^= seed >> 8;        i *= 0x0929eb3fu;
+                i ^= seed >> 23;
+                i ^= (i & w) >> 1;     i *= 1u | seed >> 27;
+                i *= 0x6935fa69u;
+                i ^= (i & w) >> 11;    i *= 0x74dcb303u;
+                i ^= (i & w) >> 2;     i *= 0x9e501cc3u;
+                i ^= (i & w) >> 2;     i *= 0xc860a3dfu;
+                i &= w;
+                i ^= i >> 5;
+            }
+            while (i >= n);
+            return (i + seed) % n;
+        }
+
+        /// Sobol sequence, optionally with a random linear matrix scramble and digital shift (Matousek 1998)
+        /// that are the same for a given seed.  The direction numbers of each dimension come from the next
+        /// primitive polynomial over GF(2), with the free initial values drawn from a fixed stream.
+        class sobol_sequence
+        {
+        private:
+            /// Bits of each coordinate, so the sequence has 2^bits points
+            static const int bits = 52;
+
+            /// Direction numbers v[dimension][bit], and the digital shift of each dimension
+            std::vector<std::vector<unsigned long long>> v;
+            std::vector<unsigned long long> shift;
+
+            /// Multiply the polynomials a and b modulo p of the given degree
+            static unsigned long long mulmod(unsigned long long a, unsigned long long b, unsigned long long p, int degree)
+            {
+                unsigned long long r = 0;
+                for (; b; b >>= 1)
+                {
+                    if (b & 1) r ^= a;
+                    a <<= 1;
+                    if (a >> degree & 1) a ^= p;
+                }
+                return r;
+            }
+
+            /// x^e modulo p
+            static unsigned long long powmod(unsigned long long e, unsigned long long p, int degree)
+            {
+                unsigned long long r = 1, x = 2;
+                for (; e; e >>= 1)
+                {
+                    if (e & 1) r = mulmod(r, x, p, degree);
+                    x = mulmod(x, x, p, degree);
+                }
+                return r;
+            }
+
+            /// Is p (with x^degree and constant terms set) primitive, i.e. is the order of x equal to 2^degree - 1?
+            static bool primitive(unsigned long long p, int degree)
+            {
+                const unsigned long long order = (1ULL << degree) - 1;
+                if (powmod(order, p, degree) != 1) return false;
+                unsigned long long m = order;
+                for (unsigned long long q = 2; q*q <= m; q++)
+                {
+                    if (m % q) continue;
+                    if (powmod(order/q, p, degree) == 1) return false;
+                    while (m % q == 0) m /= q;
+                }
+                return m == 1 or powmod(order/m, p, degree) != 1;
+            }
+
+        public:
+            sobol_sequence(int dim, bool scramble = true, unsigned long long seed = 0) : v(dim, std::vector<unsigned long long>(bits)), shift(dim, 0)
+            {
+                std::mt19937_64 initial(20261016ULL);
+                unsigned long long p = 1;
+                int degree = 0;
+
+                for (int j = 0; j < dim; j++)
+                {
+                    std::vector<unsigned long long> &vj = v[j];
+                    if (j == 0)
+                    {
+                        for (int k = 0; k < bits; k++) vj[k] = 1ULL << (bits - 1 - k);
+                    }
+                    else
+                    {
+                        // Next primitive polynomial x^degree + a_1 x^(degree-1) + ... + 1, starting from x + 1
+                        do
+                        {
+                            p += 2;
+                            if (p >> degree > 1)
+                            {
+                                degree++;
+                                p = (1ULL << degree) | 1;
+                            }
+                        }
+                        while (not primitive(p, degree));
+
+                        for (int k = 0; k < degree and k < bits; k++)
+                        {
+                            unsigned long long m = (initial() & ((2ULL << k) - 1)) | 1;
+                            vj[k] = m << (bits - 1 - k);
+                        }
+                        for (int k = degree; k < bits; k++)
+                        {
+                            vj[k] = vj[k - degree] ^ (vj[k - degree] >> degree);
+                            for (int i = 1; i < degree; i++)
+                            {
+                                if (p >> (degree - i) & 1) vj[k] ^= vj[k - i];
+                            }
+                        }
+                    }
+                }
+
+                if (scramble)
+                {
+                    std::mt19937_64 rng(seed);
+                    for (int j = 0; j < dim; j++)
+                    {
+                        // Lower triangular matrix with unit diagonal: digit i of the result mixes digits 1 ... i.
+                        std::vector<unsigned long long> rows(bits);
+                        for (int i = 0; i < bits; i++)
+                        {
+                            const unsigned long long diag = 1ULL << (bits - 1 - i);
+                            rows[i] = (rng() & ~(2*diag - 1) & ((1ULL << bits) - 1)) | diag;
+                        }
+                        for (int k = 0; k < bits; k++)
+                        {
+                            unsigned long long out = 0;
+                            for (int i = 0; i < bits; i++)
+                            {
+                                if (__builtin_parityll(rows[i] & v[j][k])) out |= 1ULL << (bits - 1 - i);
+                            }
+                            v[j][k] = out;
+                        }
+                        shift[j] = rng() & ((1ULL << bits) - 1);
+                    }
+                }
+            }
+
+            /// Point n of the sequence (in Gray code order), strictly inside the unit hypercube
+            void point(unsigned long long n, std::vector<double> &x) const
+            {
+                const unsigned long long gray = n ^ (n >> 1);
+                for (size_t j = 0; j < v.size(); j++)
+                {
+                    unsigned long long X = shift[j];
+                    for (int k = 0; k < bits and (gray >> k); k++)
+                    {
+                        if (gray >> k & 1) X ^= v[j][k];
+                    }
+                    x[j] = (X + 0.5)/double(1ULL << bits);
+                }
+            }
+        };
+
+        /// Point i of an n-point Latin hypercube chosen by seed: along each dimension, every one of the n
+        /// equal strata holds exactly one point, at a random position within it (or at its centre).
+        inline void latin_hypercube_point(unsigned int i, unsigned int n, unsigned long long seed, bool centred, std::vector<double> &x)
+        {
+            for (size_t j = 0; j < x.size(); j++)
+            {
+                const unsigned long long s = hash64(seed*x.size() + j);
+                const double offset = centred ? 0.5 : hash_uniform(i, s);
+                x[j] = (hash_permute(i, n, (unsigned int)s) + offset)/n;
+            }
+        }
+
+    }
+
+}
+
+#endif
@@ -12,6 +12,9 @@
 ///           (gregory.david.martinez@gmail.com)
 ///  \date 2014 May
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 #ifndef TWALK_HPP
 #define TWALK_HPP
@@ -169,6 +172,7 @@ namespace Gambit
                         while(tints[ttt = freePts*gDev[0]->Doub()] == tt);
 
                         //double ct = gDev[0]->Max(&a0[tt][0], &a0[tints[ttt]][0]);
+                        ttt = tints[ttt];
         #else
                         int ttt = (a0.size()-2)*gDev[0]->Doub();
                         if (t < tt)
@@ -220,6 +224,7 @@ namespace Gambit
 
                         //double ct = gDev[0]->Max(&a0[tt][0], &a0[tints[ttt]][0]);
                         //std::cout << ct << "   " << t << "   " << tints[ttt] << std::endl;getchar();
+                        ttt = tints[ttt];
         #else
                         int ttt = (a0.size()-2)*gDev[0]->Doub();
                         if (t < tt)
@@ -294,6 +299,27 @@ namespace Gambit
                    const int &save_freq,
                    const double &hrs_max);
 
+        #ifdef WITH_MPI
+        /// TWalk in which each process moves its own chains independently, and only hands some of
+        /// them to another process (without waiting for it) every sync_interval steps.
+        void TWalkAsync(Gambit::Scanner::like_ptr LogLike,
+                        Gambit::Scanner::printer_interface &printer,
+                        Gambit::Scanner::resume_params_func set_resume_params,
+                        const int &dimension,
+                        const double &div,
+                        const int &proj,
+                        const double &din,
+                        const double &alim,
+                        const double &alimt,
+                        const double &sqrtR,
+                        const int &NChains,
+                        const bool &hyper_grid,
+                        const int &burn_in,
+                        const int &save_freq,
+                        const double &mins_max,
+                        const int &sync_interval);
+        #endif
+
         #endif
 
         /*
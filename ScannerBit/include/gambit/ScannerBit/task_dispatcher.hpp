@@ -0,0 +1,237 @@
+//  GAMBIT: Global and Modular BSM Inference Tool
+//  *********************************************
+/// \file
+///
+///  Dispatcher for sharing out a fixed number of
+///  tasks (e.g. grid points) between MPI processes.
+///
+///  In static mode, process r takes the tasks
+///  r, r + N, r + 2N, ... for N processes.
+///
+///  In dynamic mode with more than one process,
+///  rank 0 becomes a master that does no work
+///  itself, and hands out batches of tasks to the
+///  other processes whenever they ask.  Each worker
+///  asks for its next batch as soon as it starts
+///  the current one, so it rarely waits for the
+///  master.  This balances the load when the cost
+///  of a task varies a lot.
+///
+///  Usage (in a scanner plugin):
+///
+///   Gambit::Scanner::task_dispatcher tasks(ntasks, dynamic, batch_size);
+///   unsigned long long i;
+///   while (tasks.next(i))
+///   {
+///     /* Evaluate task i */
+///     if (Gambit::Scanner::Plugins::plugin_info.early_shutdown_in_progress()) tasks.quit();
+///   }
+///
+///  In dynamic mode, all processes must construct
+///  the dispatcher (it duplicates MPI_COMM_WORLD)
+///  and keep calling next() until it returns false.
+///  Plugins using it should also call
+///  disable_external_shutdown() on their like_ptr,
+///  as the master never evaluates the likelihood
+///  and so cannot take part in the soft shutdown.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#ifndef __task_dispatcher_hpp__
+#define __task_dispatcher_hpp__
+
+#include <vector>
+#include <algorithm>
+
+#include "gambit/Utils/mpiwrapper.hpp"
+#include "gambit/Logs/logger.hpp"
+
+namespace Gambit
+{
+
+    namespace Scanner
+    {
+
+        /// Shares out the indices 0 ... ntasks-1 between processes
+        class task_dispatcher
+        {
+        private:
+            /// Total number of tasks, and number handed out per request in dynamic mode
+            unsigned long long ntasks, batch_size;
+            /// Next task to hand out (by the master, or by this process in static mode), and the current batch [start, end) of this process
+            unsigned long long next_task, start, end;
+            /// Hand out tasks on demand?
+            bool dynamic;
+            /// Set when this process wants to stop early
+            bool quitting;
+            /// Set once this process has been told there is no more work
+            bool finished;
+            int rank, numtasks;
+
+#ifdef WITH_MPI
+            GMPI::Comm comm;
+            static const int request_tag = 1;
+            static const int assign_tag = 2;
+            /// Request sent to the master; 1 if this process is quitting, 0 otherwise
+            int request;
+            /// Assignment received from the master: {start, end}; an empty range means stop
+            unsigned long long assignment[2];
+            MPI_Request request_req, assign_req;
+            /// Is there a request for work still waiting for its answer?
+            bool pending;
+
+            /// Ask the master for the next batch, without waiting for the answer
+            void ask()
+            {
+                request = quitting ? 1 : 0;
+                comm.Isend(&request, 1, 0, request_tag, &request_req);
+                comm.Irecv(assignment, 2, 0, assign_tag, &assign_req);
+                pending = true;
+            }
+
+            /// Wait for the answer to the last request
+            void collect()
+            {
+                comm.Wait(&request_req);
+                comm.Wait(&assign_req);
+                pending = false;
+            }
+
+            /// Hand out work until every worker has been told to stop
+            void serve()
+            {
+                int running = numtasks - 1;
+                bool quit_seen = false;
+                std::vector<bool> stopped(numtasks, false);
+
+                logger() << LogTags::debug << LogTags::scanner << "Task dispatcher: handing out " << ntasks
+                         << " tasks in batches of " << batch_size << " to " << running << " workers." << EOM;
+
+                while (running > 0)
+                {
+                    MPI_Status status;
+                    int msg;
+                    unsigned long long reply[2];
+                    comm.Probe(MPI_ANY_SOURCE, request_tag, &status);
+                    int worker = status.MPI_SOURCE;
+                    comm.Recv(&msg, 1, worker, request_tag);
+                    if (msg == 1) quit_seen = true;
+
+                    if (quit_seen or next_task >= ntasks or stopped[worker])
+                    {
+                        reply[0] = reply[1] = 0;
+                        if (not stopped[worker])
+                        {
+                            stopped[worker] = true;
+                            running--;
+                        }
+                    }
+                    else
+                    {
+                        reply[0] = next_task;
+                        reply[1] = next_task = std::min(next_task + batch_size, ntasks);
+                    }
+                    comm.Send(reply, 2, worker, assign_tag);
+                }
+
+                logger() << LogTags::debug << LogTags::scanner << "Task dispatcher: " << next_task << " of " << ntasks
+                         << " tasks handed out" << (quit_seen ? " before early shutdown." : ".") << EOM;
+            }
+#endif
+
+        public:
+            /// Set up the dispatch of ntasks tasks, statically or on demand (batch_size at a time)
+            task_dispatcher(unsigned long long ntasks, bool dynamic = false, unsigned long long batch_size = 1)
+                : ntasks(ntasks), batch_size(std::max(batch_size, 1ULL)), next_task(0), start(0), end(0),
+                  dynamic(dynamic), quitting(false), finished(false), rank(0), numtasks(1)
+            {
+#ifdef WITH_MPI
+                pending = false;
+                if (dynamic)
+                {
+                    comm.dup(MPI_COMM_WORLD, "TaskDispatcherComm");
+                    rank = comm.Get_rank();
+                    numtasks = comm.Get_size();
+                    if (numtasks > 1 and rank != 0) ask();
+                }
+                else
+                {
+                    MPI_Comm_size(MPI_COMM_WORLD, &numtasks);
+                    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+                }
+#endif
+                if (not dynamic) next_task = rank;
+            }
+
+            /// Get the next task for this process.  Returns false once there is no more work for it.
+            bool next(unsigned long long &task)
+            {
+                if (finished) return false;
+
+                if (start < end and not quitting)
+                {
+                    task = start++;
+                    return true;
+                }
+
+#ifdef WITH_MPI
+                if (dynamic and numtasks > 1)
+                {
+                    if (rank == 0)
+                    {
+                        serve();
+                        finished = true;
+                        return false;
+                    }
+
+                    // Take the batch asked for earlier, and ask for the one after it straight away.
+                    // A worker that is quitting keeps asking (with the quit flag set) until it is told to stop.
+                    while (true)
+                    {
+                        if (not pending) ask();
+                        collect();
+                        start = assignment[0];
+                        end = assignment[1];
+                        if (start >= end)
+                        {
+                            finished = true;
+                            return false;
+                        }
+                        if (not quitting) break;
+                    }
+                    ask();
+                    task = start++;
+                    return true;
+                }
+#endif
+
+                if (quitting or next_task >= ntasks)
+                {
+                    finished = true;
+                    return false;
+                }
+                task = next_task;
+                next_task += dynamic ? 1 : numtasks;
+                return true;
+            }
+
+            /// Stop taking new work (e.g. because early shutdown is in progress), and tell the master
+            /// to stop handing out work to all the other processes too.
+            void quit() { quitting = true; }
+
+            /// Is this the master process, which hands out work but does none itself?
+            bool is_master() const { return dynamic and numtasks > 1 and rank == 0; }
+        };
+
+    }
+
+}
+
+#endif
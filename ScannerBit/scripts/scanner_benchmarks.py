@@ -0,0 +1,260 @@
+#!/usr/bin/env python
+#
+# GAMBIT: Global and Modular BSM Inference Tool
+#*********************************************
+# \file
+#
+#  Benchmark suite for the scanner plugins.
+#
+#  Runs ScannerBit_standalone with every
+#  scanner below on every benchmark objective
+#  (ScannerBit/src/objectives/test_functions/
+#  benchmarks.cpp), with fixed settings and
+#  seeds, and writes a JSON report of the
+#  number of objective calls, the wall time,
+#  the time spent in the objective and in the
+#  scanner and GAMBIT, and how close each scan
+#  got to the maximum and (for nested samplers)
+#  to the evidence.  Build and run it with
+#
+#    make scanner_benchmarks
+#
+#  or run it directly; see --help.
+#
+#  GreAT is left out as its random numbers
+#  cannot be seeded, and the postprocessor as
+#  it does not scan.
+#
+#*********************************************
+#
+#  Authors (add name and date if you modify):
+#
+#  \author The GAMBIT Collaboration
+#  \date 2026 Oct
+#
+#*********************************************
+from __future__ import print_function
+import os
+import re
+import sys
+import glob
+import json
+import math
+import time
+import shutil
+import argparse
+import platform
+import datetime
+import subprocess
+
+# Seed of the GAMBIT random number generator, and of every scanner that has its own
+SEED = 1
+
+# Settings of each scanner.  Changing any of these makes the results incomparable with earlier runs.
+SCANNERS = {
+    "random":          {"plugin": "random", "point_number": 20000},
+    "square_grid":     {"plugin": "square_grid", "grid_pts": 141},
+    "sobol":           {"plugin": "sobol", "point_number": 16384, "ran_seed": SEED},
+    "latin_hypercube": {"plugin": "latin_hypercube", "point_number": 16384, "ran_seed": SEED},
+    "toy_mcmc":        {"plugin": "toy_mcmc", "point_number": 20000},
+    "twalk":           {"plugin": "twalk", "ran_seed": SEED, "timeout_mins": 20},
+    "ensemble":        {"plugin": "ensemble", "walkers": 32, "steps": 1000, "ran_seed": SEED},
+    "diver":           {"plugin": "diver", "NP": 200, "seed": SEED, "verbosity": 0},
+    "multinest":       {"plugin": "multinest", "nlive": 400, "tol": 0.5, "seed": SEED, "fb": False},
+    "polychord":       {"plugin": "polychord", "nlive": 200, "tol": 0.5, "seed": SEED, "fb": 0},
+    "minuit2":         {"plugin": "minuit2", "print_level": 0},
+}
+
+def logaddexp(x, y):
+    return max(x, y) + math.log1p(math.exp(-abs(x - y)))
+
+def rosenbrock(x):
+    return -sum((1. - x[i])**2 + 100.*(x[i+1] - x[i]**2)**2 for i in range(len(x) - 1))
+
+def himmelblau(x):
+    return -(x[0]**2 + x[1] - 11.)**2 - (x[0] + x[1]**2 - 7.)**2
+
+def ackley(x):
+    r2 = sum(p*p for p in x)
+    c = sum(math.cos(2.*math.pi*p) for p in x)
+    return 20.*math.exp(-0.2*math.sqrt(r2/len(x))) + math.exp(c/len(x)) - math.e - 20.
+
+def eggbox(x):
+    prod = 1.
+    for p in x: prod *= math.cos(5.*math.pi*p)
+    return (2. + prod)**5
+
+def rastrigin(x):
+    return -sum(p*p - 10.*math.cos(2.*math.pi*p) + 10. for p in x)
+
+def beale(x):
+    return -(1.5 - x[0] + x[0]*x[1])**2 - (2.25 - x[0] + x[0]*x[1]**2)**2 - (2.625 - x[0] + x[0]*x[1]**3)**2
+
+def shells(x):
+    radius, width = 2., 0.1
+    norm = -0.5*math.log(2.*math.pi*width*width)
+    delta = [norm - (math.sqrt(sum((p - c)**2 for p in x)) - radius)**2/(2.*width*width) for c in (-3.5, 3.5)]
+    return logaddexp(delta[0], delta[1])
+
+# Prior ranges of the objectives (all flat), and a point where each one is maximal.  These mirror benchmarks.cpp.
+OBJECTIVES = {
+    "rosenbrock": {"f": rosenbrock, "ranges": [[-2., 2.], [-1., 3.]],       "argmax": [1., 1.]},
+    "himmelblau": {"f": himmelblau, "ranges": [[-5., 5.], [-5., 5.]],       "argmax": [3., 2.]},
+    "ackley":     {"f": ackley,     "ranges": [[-5., 5.], [-5., 5.]],       "argmax": [0., 0.]},
+    "eggbox":     {"f": eggbox,     "ranges": [[0., 1.], [0., 1.]],         "argmax": [0.4, 0.4]},
+    "rastrigin":  {"f": rastrigin,  "ranges": [[-5.12, 5.12], [-5.12, 5.12]], "argmax": [0., 0.]},
+    "beale":      {"f": beale,      "ranges": [[-4.5, 4.5], [-4.5, 4.5]],   "argmax": [3., 0.5]},
+    # The shells barely overlap, so the maximum is (to double precision) anywhere on either of them.
+    "shells":     {"f": shells,     "ranges": [[-6., 6.], [-6., 6.]],       "argmax": [-3.5 + 2./math.sqrt(2.), -3.5 + 2./math.sqrt(2.)]},
+}
+
+def reference_lnZ(obj, n):
+    """Log of the mean of the likelihood over the prior box, by the midpoint rule on an n x n grid."""
+    f = obj["f"]
+    (a0, b0), (a1, b1) = obj["ranges"]
+    h0, h1 = (b0 - a0)/n, (b1 - a1)/n
+    lnL = [f([a0 + (i + 0.5)*h0, a1 + (j + 0.5)*h1]) for i in range(n) for j in range(n)]
+    top = max(lnL)
+    return top + math.log(sum(math.exp(l - top) for l in lnL)) - math.log(len(lnL))
+
+def inifile(scanner, objective, outdir):
+    """The configuration of one run.  YAML is a superset of JSON, so it is written as JSON."""
+    settings = dict(SCANNERS[scanner])
+    settings["like"] = "LogLike"
+    params = {}
+    for i, r in enumerate(OBJECTIVES[objective]["ranges"]):
+        params["param_" + str(i)] = {"range": r}
+    return {
+        "Parameters": {},
+        "Priors": {},
+        "Printer": {"printer": "ascii", "options": {"output_file": "samples.dat"}},
+        "Scanner": {
+            "use_scanner": scanner,
+            "use_objectives": objective,
+            "scanners": {scanner: settings},
+            "objectives": {objective: {"plugin": objective, "purpose": "LogLike", "parameters": params}},
+        },
+        "Logger": {"redirection": {"[Default]": "default.log", "[Warning]": "warnings.log", "[Error]": "errors.log"}},
+        "KeyValues": {
+            "default_output_path": outdir,
+            "rng": {"generator": "mt19937_64", "seed": SEED},
+            "likelihood": {"model_invalid_for_lnlike_below": -1e10},
+        },
+    }
+
+def native_evidence(outdir):
+    """The log evidence and its error from the native output of MultiNest or PolyChord, if there is any."""
+    patterns = [("*stats.dat", r"Nested Sampling Global Log-Evidence\s*:\s*(\S+)\s*\+/-\s*(\S+)"),
+                ("*.stats", r"log\(Z\)\s*=\s*(\S+)\s*\+/-\s*(\S+)")]
+    for name, regex in patterns:
+        for path in glob.glob(os.path.join(outdir, "scanner_plugins", "*", name)):
+            with open(path) as f:
+                m = re.search(regex, f.read())
+            if m:
+                return float(m.group(1)), float(m.group(2))
+    return None, None
+
+def run(args, scanner, objective, lnZ_ref):
+    outdir = os.path.join(os.path.abspath(args.output_dir), scanner, objective)
+    if os.path.isdir(outdir): shutil.rmtree(outdir)
+    os.makedirs(outdir)
+    yaml_file = os.path.join(outdir, "benchmark.yaml")
+    config = inifile(scanner, objective, outdir)
+    with open(yaml_file, "w") as f:
+        json.dump(config, f, indent=2)
+
+    command = [args.executable, "-r", "-f", yaml_file]
+    if args.mpi > 1: command = args.mpirun.split() + ["-np", str(args.mpi)] + command
+    result = {"scanner": scanner, "objective": objective, "dimension": len(OBJECTIVES[objective]["ranges"]),
+              "settings": config["Scanner"]["scanners"][scanner]}
+
+    start = time.time()
+    with open(os.path.join(outdir, "stdout.txt"), "w") as log:
+        proc = subprocess.Popen(command, stdout=log, stderr=subprocess.STDOUT)
+        while proc.poll() is None and time.time() - start < args.timeout: time.sleep(0.01)
+        if proc.poll() is None:
+            proc.kill()
+            proc.wait()
+            result["status"] = "timeout"
+        else:
+            result["status"] = "ok" if proc.returncode == 0 else "failed"
+    result["wall_seconds"] = time.time() - start
+
+    # Sum the statistics of the objective over the processes.
+    calls, objective_seconds, overhead_seconds, best, best_point = 0, 0., 0., None, None
+    stats = glob.glob(os.path.join(outdir, "scanner_plugins", "benchmarks", objective + "_stats_*.json"))
+    for path in stats:
+        with open(path) as f:
+            s = json.load(f)
+        calls += s["calls"]
+        objective_seconds += s["objective_seconds"]
+        overhead_seconds += s["scan_seconds"] - s["objective_seconds"]
+        if s["best_lnlike"] is not None and (best is None or s["best_lnlike"] > best):
+            best, best_point = s["best_lnlike"], s["best_point"]
+    if result["status"] == "ok" and not stats: result["status"] = "no statistics"
+
+    obj = OBJECTIVES[objective]
+    optimum = obj["f"](obj["argmax"]) + 0.
+    result.update({
+        "calls": calls,
+        "objective_seconds": objective_seconds,
+        "overhead_seconds": overhead_seconds,
+        "overhead_microseconds_per_call": 1e6*overhead_seconds/calls if calls else None,
+        "best_lnlike": best,
+        "best_point": best_point,
+        "optimum_lnlike": optimum,
+        "optimum_gap": optimum - best if best is not None else None,
+    })
+
+    lnZ, lnZ_err = native_evidence(outdir)
+    if lnZ is not None:
+        result.update({"lnZ": lnZ, "lnZ_error": lnZ_err, "lnZ_reference": lnZ_ref, "lnZ_bias": lnZ - lnZ_ref,
+                       "lnZ_pull": (lnZ - lnZ_ref)/lnZ_err if lnZ_err > 0 else None})
+    return result
+
+def main():
+    parser = argparse.ArgumentParser(description="Run every scanner on every benchmark objective with fixed settings "
+                                                 "and seeds, and write the results to a JSON file.")
+    parser.add_argument("-e", "--executable", default="ScannerBit_standalone", help="the ScannerBit_standalone executable")
+    parser.add_argument("-o", "--output", default="scanner_benchmarks.json", help="the JSON report")
+    parser.add_argument("-d", "--output-dir", default="runs/scanner_benchmarks", help="where to put the output of the scans")
+    parser.add_argument("-s", "--scanners", nargs="+", default=sorted(SCANNERS), choices=sorted(SCANNERS), metavar="SCANNER",
+                        help="scanners to run (default: all of " + ", ".join(sorted(SCANNERS)) + ")")
+    parser.add_argument("-b", "--objectives", nargs="+", default=sorted(OBJECTIVES), choices=sorted(OBJECTIVES), metavar="OBJECTIVE",
+                        help="objectives to run on (default: all of " + ", ".join(sorted(OBJECTIVES)) + ")")
+    parser.add_argument("-n", "--mpi", type=int, default=1, help="number of MPI processes for each scan")
+    parser.add_argument("--mpirun", default="mpirun", help="the MPI launcher")
+    parser.add_argument("-t", "--timeout", type=float, default=3600., help="time limit of each scan in seconds")
+    parser.add_argument("-g", "--grid", type=int, default=1000, help="grid points per dimension for the reference evidences")
+    args = parser.parse_args()
+
+    version = subprocess.Popen([args.executable, "-v"], stdout=subprocess.PIPE, universal_newlines=True).communicate()[0]
+    report = {
+        "date": datetime.datetime.now().isoformat(),
+        "version": version.strip().replace("This is ScannerBit v", ""),
+        "host": platform.node(),
+        "platform": platform.platform(),
+        "processes": args.mpi,
+        "seed": SEED,
+        "runs": [],
+    }
+
+    for objective in args.objectives:
+        print("Computing the reference evidence of " + objective + "...")
+        lnZ_ref = reference_lnZ(OBJECTIVES[objective], args.grid)
+        for scanner in args.scanners:
+            print("Running " + scanner + " on " + objective + "... ", end="")
+            sys.stdout.flush()
+            r = run(args, scanner, objective, lnZ_ref)
+            report["runs"].append(r)
+            print("{0}: {1} calls in {2:.2f} s, {3} us per call outside the objective, best lnL {4}".format(r["status"], r["calls"],
+                  r["wall_seconds"], "-" if r["overhead_microseconds_per_call"] is None else "{0:.2f}".format(r["overhead_microseconds_per_call"]),
+                  r["best_lnlike"]))
+            with open(args.output, "w") as f:
+                json.dump(report, f, indent=2, sort_keys=True)
+
+    print("Results written to " + args.output)
+    return 0 if all(r["status"] == "ok" for r in report["runs"]) else 1
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,230 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Analytic test functions for benchmarking the
+///  scanners (see ScannerBit/scripts/
+///  scanner_benchmarks.py), as defined in
+///  gambit/Utils/test_functions.hpp and also
+///  used by ObjectivesBit.  Each one counts its
+///  calls, times itself and keeps the best point
+///  found, and writes these to
+///
+///    <default_output_path>/benchmarks/
+///      <name>_stats_<rank>.json
+///
+///  when it is unloaded.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#include <cmath>
+#include <chrono>
+#include <limits>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <iomanip>
+#include <unordered_map>
+
+#include "gambit/ScannerBit/objective_plugin.hpp"
+#include "gambit/Utils/util_functions.hpp"
+#include "gambit/Utils/test_functions.hpp"
+
+namespace Gambit
+{
+
+    namespace Scanner
+    {
+
+        /// Calls, time and best point of a benchmark objective
+        class objective_benchmark
+        {
+        private:
+            typedef std::chrono::steady_clock clock;
+
+            std::string name, file;
+            std::vector<std::string> keys;
+            std::vector<double> x, best_x;
+            double best;
+            unsigned long long calls;
+            clock::duration objective_time;
+            clock::time_point first, last;
+
+        public:
+            objective_benchmark() : best(-std::numeric_limits<double>::infinity()), calls(0), objective_time(0) {}
+
+            void init(const std::string &plugin_name, const std::vector<std::string> &parameters, const std::string &path, int rank)
+            {
+                name = plugin_name;
+                keys = parameters;
+                x.resize(keys.size());
+                file = Utils::ensure_path_exists(path + "/benchmarks/") + name + "_stats_" + std::to_string(rank) + ".json";
+            }
+
+            /// Evaluate f at the point in map, timing only f itself.
+            template <typename F>
+            double operator()(std::unordered_map<std::string, double> &map, F f)
+            {
+                for (size_t i = 0; i < keys.size(); i++) x[i] = map[keys[i]];
+
+                const clock::time_point start = clock::now();
+                const double lnlike = f(x);
+                last = clock::now();
+
+                if (calls++ == 0) first = start;
+                objective_time += last - start;
+                if (lnlike > best)
+                {
+                    best = lnlike;
+                    best_x = x;
+                }
+
+                return lnlike;
+            }
+
+            /// Write the statistics of this process.  The scan time runs from the start of the first call to the
+            /// end of the last one, so everything in it but the objective time is spent in the scanner or GAMBIT.
+            void write() const
+            {
+                std::ofstream out(file);
+                out << std::setprecision(17);
+                out << "{" << std::endl;
+                out << "  \"objective\": \"" << name << "\"," << std::endl;
+                out << "  \"calls\": " << calls << "," << std::endl;
+                out << "  \"objective_seconds\": " << std::chrono::duration<double>(objective_time).count() << "," << std::endl;
+                out << "  \"scan_seconds\": " << (calls > 0 ? std::chrono::duration<double>(last - first).count() : 0.) << "," << std::endl;
+                if (calls > 0 and std::isfinite(best))
+                {
+                    out << "  \"best_lnlike\": " << best << "," << std::endl;
+                    out << "  \"best_point\": {";
+                    for (size_t i = 0; i < keys.size(); i++)
+                    {
+                        out << (i ? ", " : "") << "\"" << keys[i] << "\": " << best_x[i];
+                    }
+                    out << "}" << std::endl;
+                }
+                else
+                {
+                    out << "  \"best_lnlike\": null," << std::endl;
+                    out << "  \"best_point\": null" << std::endl;
+                }
+                out << "}" << std::endl;
+            }
+        };
+
+    }
+
+}
+
+/// Declares the plugin_constructor and plugin_deconstructor of a benchmark objective of the given number of
+/// parameters (or at least min_dim parameters, if dim is zero).
+#define BENCHMARK_OBJECTIVE_SETUP(plug_name, min_dim, dim)                                                      \
+    Gambit::Scanner::objective_benchmark bench;                                                                 \
+                                                                                                                \
+    plugin_constructor                                                                                          \
+    {                                                                                                           \
+        const unsigned int n = get_keys().size();                                                               \
+        if (n < min_dim or (dim > 0 and n != dim))                                                              \
+        {                                                                                                       \
+            scan_err << #plug_name ": Need to have " << (dim > 0 ? "" : "at least ")                           \
+                     << (dim > 0 ? dim : min_dim) << " parameters." << scan_end;                              \
+        }                                                                                                       \
+        bench.init(#plug_name, get_keys(), get_inifile_value<std::string>("default_output_path"),               \
+                   get_printer().get_stream()->getRank());                                                      \
+    }                                                                                                           \
+                                                                                                                \
+    plugin_deconstructor                                                                                        \
+    {                                                                                                           \
+        bench.write();                                                                                          \
+    }                                                                                                           \
+
+/// Minus the Rosenbrock function of two or more parameters (see Gambit::TestFunctions).
+objective_plugin(rosenbrock, version(1, 0, 0))
+{
+    BENCHMARK_OBJECTIVE_SETUP(rosenbrock, 2, 0)
+
+    double plugin_main(std::unordered_map<std::string, double> &map)
+    {
+        print_parameters(map);
+        return bench(map, Gambit::TestFunctions::rosenbrock);
+    }
+}
+
+/// Minus Himmelblau's function (see Gambit::TestFunctions).
+objective_plugin(himmelblau, version(1, 0, 0))
+{
+    BENCHMARK_OBJECTIVE_SETUP(himmelblau, 2, 2)
+
+    double plugin_main(std::unordered_map<std::string, double> &map)
+    {
+        print_parameters(map);
+        return bench(map, Gambit::TestFunctions::himmelblau);
+    }
+}
+
+/// Minus the Ackley function (see Gambit::TestFunctions).
+objective_plugin(ackley, version(1, 0, 0))
+{
+    BENCHMARK_OBJECTIVE_SETUP(ackley, 1, 0)
+
+    double plugin_main(std::unordered_map<std::string, double> &map)
+    {
+        print_parameters(map);
+        return bench(map, Gambit::TestFunctions::ackley);
+    }
+}
+
+/// Test problem 2 of arXiv:1306.2144, on [0, 1]^n (see Gambit::TestFunctions).
+objective_plugin(eggbox, version(1, 0, 0))
+{
+    BENCHMARK_OBJECTIVE_SETUP(eggbox, 1, 0)
+
+    double plugin_main(std::unordered_map<std::string, double> &map)
+    {
+        print_parameters(map);
+        return bench(map, Gambit::TestFunctions::eggbox);
+    }
+}
+
+/// Minus the Rastrigin function (see Gambit::TestFunctions).
+objective_plugin(rastrigin, version(1, 0, 0))
+{
+    BENCHMARK_OBJECTIVE_SETUP(rastrigin, 1, 0)
+
+    double plugin_main(std::unordered_map<std::string, double> &map)
+    {
+        print_parameters(map);
+        return bench(map, Gambit::TestFunctions::rastrigin);
+    }
+}
+
+/// Minus the Beale function (see Gambit::TestFunctions).
+objective_plugin(beale, version(1, 0, 0))
+{
+    BENCHMARK_OBJECTIVE_SETUP(beale, 2, 2)
+
+    double plugin_main(std::unordered_map<std::string, double> &map)
+    {
+        print_parameters(map);
+        return bench(map, Gambit::TestFunctions::beale);
+    }
+}
+
+/// Test problem 1 of arXiv:1306.2144: two Gaussian shells (see Gambit::TestFunctions).
+objective_plugin(shells, version(1, 0, 0))
+{
+    BENCHMARK_OBJECTIVE_SETUP(shells, 1, 0)
+
+    double plugin_main(std::unordered_map<std::string, double> &map)
+    {
+        print_parameters(map);
+        return bench(map, Gambit::TestFunctions::shells);
+    }
+}
@@ -26,6 +26,7 @@
 
 #include <cstdlib>
 #include <iomanip>
+#include <limits>
 #include <unistd.h>
 #include <iostream>
 #include <fstream>
@@ -34,6 +35,7 @@
 #include "gambit/ScannerBit/scanner_utils.hpp"
 #include "gambit/ScannerBit/plugin_comparators.hpp"
 #include "gambit/ScannerBit/plugin_loader.hpp"
+#include "gambit/ScannerBit/prescreen.hpp"
 #include "gambit/cmake/cmake_variables.hpp"
 #include "gambit/Utils/table_formatter.hpp"
 #include "gambit/Utils/screen_print_utils.hpp"
@@ -608,6 +610,35 @@ namespace Gambit
                 }
             }
 
+            Likelihood_Prescreen *pluginInfo::prescreen(const std::string &purpose)
+            {
+                if (not options.hasKey("prescreen"))
+                    return NULL;
+
+                Options prescreen_options = options.getOptions("prescreen");
+                if (prescreen_options.getValueOrDef<std::string>("LogLike", "like") != purpose)
+                    return NULL;
+
+                Likelihood_Prescreen *&p = prescreens[purpose];
+                if (p == NULL)
+                {
+                    double min_LogL = options.getValueOrDef<double>(0.9*std::numeric_limits<double>::lowest(), "model_invalid_for_lnlike_below");
+                    double alt_min_LogL = options.getValueOrDef<double>(0.5*min_LogL, "model_invalid_for_lnlike_below_alt");
+                    p = new Likelihood_Prescreen(prescreen_options, purpose, min_LogL, alt_min_LogL);
+                }
+
+                return p;
+            }
+
+            void pluginInfo::prescreen_report()
+            {
+                for (auto it = prescreens.begin(), end = prescreens.end(); it != end; ++it)
+                {
+                    std::string path = Gambit::Utils::ensure_path_exists(def_out_path + "/prescreen/");
+                    it->second->report(path + it->first + "_calibration_" + std::to_string(MPIrank) + ".txt", MPIrank);
+                }
+            }
+
             void pluginInfo::dump()
             {
                 for (auto it = resume_data.begin(), end = resume_data.end(); it != end; ++it)
@@ -673,6 +704,11 @@ namespace Gambit
                 {
                     delete it->second;
                 }
+
+                for (auto it = prescreens.begin(), end = prescreens.end(); it != end; ++it)
+                {
+                    delete it->second;
+                }
             }
 
             pluginInfo::pluginInfo()
@@ -690,6 +726,63 @@ namespace Gambit
                scannerComm = newcomm;
                MPIdata_is_init = true;
                MPIrank = scanComm().Get_rank();
+               const int size = scanComm().Get_size();
+               threshold_msgs.assign(size, 0.);
+               threshold_requests.assign(size, MPI_REQUEST_NULL);
+               thresholds_sent.assign(size, 0);
+               thresholds_received.assign(size, 0);
+            }
+
+            void pluginInfo::send_lnlike_threshold(double threshold)
+            {
+               GMPI::Comm& comm(scanComm());
+               for (int dest = 0; dest < comm.Get_size(); dest++)
+               {
+                  if (dest == MPIrank) continue;
+                  // Never overwrite a buffer that is still being sent.
+                  if (threshold_requests[dest] != MPI_REQUEST_NULL and not comm.Test(&threshold_requests[dest])) continue;
+                  threshold_msgs[dest] = threshold;
+                  comm.Isend(&threshold_msgs[dest], 1, dest, LNLIKE_THRESHOLD_MSG, &threshold_requests[dest]);
+                  thresholds_sent[dest]++;
+               }
+            }
+
+            bool pluginInfo::recv_lnlike_threshold(double &threshold)
+            {
+               GMPI::Comm& comm(scanComm());
+               bool received = false;
+               MPI_Status status;
+               while (comm.Iprobe(MPI_ANY_SOURCE, LNLIKE_THRESHOLD_MSG, &status))
+               {
+                  comm.Recv(&threshold, 1, status.MPI_SOURCE, LNLIKE_THRESHOLD_MSG);
+                  thresholds_received[status.MPI_SOURCE]++;
+                  received = true;
+               }
+               return received;
+            }
+
+            void pluginInfo::finish_lnlike_threshold_messages()
+            {
+               // Every process learns how many messages were sent to it, and receives those it has not had yet.
+               // Only then are the sends waited on, so that none can be stuck waiting for a receive.
+               GMPI::Comm& comm(scanComm());
+               const MPI_Datatype datatype = GMPI::get_mpi_data_type<int>::type();
+               std::vector<int> expected(comm.Get_size(), 0);
+               MPI_Alltoall(&thresholds_sent[0], 1, datatype, &expected[0], 1, datatype, *(comm.get_boundcomm()));
+               for (int source = 0; source < comm.Get_size(); source++)
+               {
+                  for (; thresholds_received[source] < expected[source]; thresholds_received[source]++)
+                  {
+                     double msg;
+                     comm.Recv(&msg, 1, source, LNLIKE_THRESHOLD_MSG);
+                  }
+               }
+               for (auto& request : threshold_requests)
+               {
+                  if (request != MPI_REQUEST_NULL) comm.Wait(&request);
+               }
+               thresholds_sent.assign(comm.Get_size(), 0);
+               thresholds_received.assign(comm.Get_size(), 0);
             }
 
             GMPI::Comm& pluginInfo::scanComm()
@@ -0,0 +1,263 @@
+//  GAMBIT: Global and Modular BSM Inference Tool
+//  *********************************************
+///  \file
+///
+///  Surrogate pre-screening of expensive
+///  objective functions, for any scanner plugin.
+///
+///  The surrogate is a Gaussian process with a
+///  squared-exponential kernel on the unit
+///  hypercube, fitted to the most recently
+///  evaluated points.  Its length scale is chosen
+///  by maximising the marginal likelihood over a
+///  grid each time the model is refitted.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#include <cmath>
+#include <limits>
+#include <fstream>
+#include <iostream>
+#include <algorithm>
+
+#include "gambit/ScannerBit/prescreen.hpp"
+#include "gambit/ScannerBit/scanner_utils.hpp"
+#include "gambit/Utils/threadsafe_rng.hpp"
+
+namespace Gambit
+{
+
+    namespace Scanner
+    {
+
+        Likelihood_Prescreen::Likelihood_Prescreen(const Options &options, const std::string &purpose, double min_LogL, double alt_min_LogL)
+          : purpose(purpose),
+            max_train(options.getValueOrDef<int>(256, "training_points")),
+            min_train(options.getValueOrDef<int>(50, "min_training_points")),
+            refit_interval(options.getValueOrDef<int>(25, "refit_interval")),
+            delta_lnlike(options.getValueOrDef<double>(50., "delta_lnlike")),
+            nsigma(options.getValueOrDef<double>(3., "nsigma")),
+            fallback_rate(options.getValueOrDef<double>(0.05, "fallback_rate")),
+            min_LogL(min_LogL), alt_min_LogL(alt_min_LogL),
+            best(-std::numeric_limits<double>::infinity()), new_points(0),
+            mean(0.), scale(1.), length(1.), noise(1e-4), nfits(0),
+            has_prediction(false), is_vetoed(false), is_audit(false),
+            pred_mean(0.), pred_sd(0.), cut(-std::numeric_limits<double>::infinity()),
+            n_screened(0), n_vetoed(0), n_audits(0), n_false_vetoes(0), n_compared(0), n_within_1sigma(0), n_covered(0),
+            sum_z(0.), sum_z2(0.)
+        {
+            min_train = std::max(min_train, size_t(2));
+            max_train = std::max(max_train, min_train);
+            refit_interval = std::max(refit_interval, size_t(1));
+            if (fallback_rate < 0. or fallback_rate > 1.)
+            {
+                scan_err << "The fallback_rate of the surrogate pre-screening must be between 0 and 1." << scan_end;
+            }
+        }
+
+        void Likelihood_Prescreen::fit()
+        {
+            const size_t n = train_y.size();
+
+            // Values far below anything the scanner would accept (e.g. invalid points) are clipped, so that
+            // they do not swamp the model.
+            const double lo = (std::isfinite(cut) ? cut : best - delta_lnlike) - delta_lnlike;
+            std::vector<double> y(n);
+            mean = 0.;
+            for (size_t i = 0; i < n; i++) mean += (y[i] = std::max(train_y[i], lo))/n;
+            double var = 0.;
+            for (size_t i = 0; i < n; i++) var += (y[i] - mean)*(y[i] - mean)/n;
+            scale = var > 0. ? std::sqrt(var) : 1.;
+            for (size_t i = 0; i < n; i++) y[i] = (y[i] - mean)/scale;
+
+            std::vector<double> d2(n*n, 0.);
+            for (size_t i = 0; i < n; i++) for (size_t j = 0; j < i; j++)
+            {
+                double sum = 0.;
+                for (size_t k = 0; k < train_x[i].size(); k++) sum += (train_x[i][k] - train_x[j][k])*(train_x[i][k] - train_x[j][k]);
+                d2[i*n + j] = d2[j*n + i] = sum;
+            }
+
+            // Try length scales from 0.01 to 2 times the diagonal of the unit hypercube.
+            const double diag = std::sqrt(double(train_x[0].size()));
+            double best_lml = -std::numeric_limits<double>::infinity();
+            std::vector<double> L(n*n), a(n);
+            chol.clear();
+            for (int g = 0; g < 12; g++)
+            {
+                const double l = 0.01*diag*std::pow(200., g/11.);
+                bool ok = true;
+                for (size_t i = 0; i < n and ok; i++)
+                {
+                    for (size_t j = 0; j <= i; j++)
+                    {
+                        double sum = std::exp(-0.5*d2[i*n + j]/(l*l)) + (i == j ? noise : 0.);
+                        for (size_t k = 0; k < j; k++) sum -= L[i*n + k]*L[j*n + k];
+                        if (i == j)
+                        {
+                            if (sum <= 0.) { ok = false; break; }
+                            L[i*n + i] = std::sqrt(sum);
+                        }
+                        else L[i*n + j] = sum/L[j*n + j];
+                    }
+                }
+                if (not ok) continue;
+
+                // Solve L L^T a = y, and get the log marginal likelihood (up to a constant).
+                for (size_t i = 0; i < n; i++)
+                {
+                    double sum = y[i];
+                    for (size_t k = 0; k < i; k++) sum -= L[i*n + k]*a[k];
+                    a[i] = sum/L[i*n + i];
+                }
+                double lml = 0.;
+                for (size_t i = 0; i < n; i++) lml -= 0.5*a[i]*a[i] + std::log(L[i*n + i]);
+                for (size_t i = n; i-- > 0;)
+                {
+                    double sum = a[i];
+                    for (size_t k = i + 1; k < n; k++) sum -= L[k*n + i]*a[k];
+                    a[i] = sum/L[i*n + i];
+                }
+
+                if (lml > best_lml)
+                {
+                    best_lml = lml;
+                    length = l;
+                    chol = L;
+                    alpha = a;
+                }
+            }
+
+            new_points = 0;
+            if (chol.empty())
+            {
+                fit_x.clear();
+                return;
+            }
+            fit_x.assign(train_x.begin(), train_x.end());
+            nfits++;
+        }
+
+        void Likelihood_Prescreen::predict(const std::vector<double> &x, double &m, double &sd) const
+        {
+            const size_t n = fit_x.size();
+            std::vector<double> k(n);
+            m = 0.;
+            for (size_t i = 0; i < n; i++)
+            {
+                double sum = 0.;
+                for (size_t j = 0; j < x.size(); j++) sum += (x[j] - fit_x[i][j])*(x[j] - fit_x[i][j]);
+                k[i] = std::exp(-0.5*sum/(length*length));
+                m += k[i]*alpha[i];
+            }
+            m = mean + scale*m;
+
+            // Variance = k(x,x) - k^T K^-1 k, with L^-1 k found by forward substitution.
+            double var = 1. + noise;
+            for (size_t i = 0; i < n; i++)
+            {
+                double sum = k[i];
+                for (size_t j = 0; j < i; j++) sum -= chol[i*n + j]*k[j];
+                k[i] = sum/chol[i*n + i];
+                var -= k[i]*k[i];
+            }
+            sd = scale*std::sqrt(std::max(var, 0.));
+        }
+
+        bool Likelihood_Prescreen::veto(const std::vector<double> &unit, double threshold)
+        {
+            has_prediction = is_vetoed = is_audit = false;
+
+            if (train_y.size() >= min_train and (fit_x.empty() or new_points >= refit_interval)) fit();
+            if (fit_x.empty()) return false;
+
+            predict(unit, pred_mean, pred_sd);
+            has_prediction = true;
+            n_screened++;
+
+            // Without a threshold from the scanner, points far below the best one found so far are skipped.
+            cut = std::isfinite(threshold) ? threshold : best - delta_lnlike;
+            if (pred_mean + nsigma*pred_sd >= cut) return false;
+
+            // Evaluate a random fraction of the points anyway, to check the model.
+            if (Random::draw() < fallback_rate)
+            {
+                is_audit = true;
+                n_audits++;
+                return false;
+            }
+
+            is_vetoed = true;
+            n_vetoed++;
+            return true;
+        }
+
+        void Likelihood_Prescreen::learn(const std::vector<double> &unit, double value)
+        {
+            if (not std::isfinite(value)) return;
+
+            if (has_prediction)
+            {
+                // Compare with the prediction, clipped like the training values.
+                const double v = std::max(value, cut - delta_lnlike);
+                const double z = pred_sd > 0. ? (v - pred_mean)/pred_sd : 0.;
+                n_compared++;
+                sum_z += z;
+                sum_z2 += z*z;
+                if (std::abs(z) <= 1.) n_within_1sigma++;
+                if (v <= pred_mean + nsigma*pred_sd) n_covered++;
+                if (is_audit and value >= cut) n_false_vetoes++;
+            }
+
+            best = std::max(best, value);
+            train_x.push_back(unit);
+            train_y.push_back(value);
+            if (train_y.size() > max_train)
+            {
+                train_x.pop_front();
+                train_y.pop_front();
+            }
+            new_points++;
+        }
+
+        void Likelihood_Prescreen::report(const std::string &filename, int rank) const
+        {
+            const double false_rate = n_audits > 0 ? double(n_false_vetoes)/n_audits : 0.;
+            const double false_err = n_audits > 0 ? std::sqrt(std::max(false_rate*(1. - false_rate), 1./n_audits)/n_audits) : 0.;
+
+            std::ofstream out(filename);
+            out << "# Calibration of the surrogate pre-screening of " << purpose << " (MPI rank " << rank << ")" << std::endl;
+            out << "Points predicted by the surrogate:                   " << n_screened << std::endl;
+            out << "  skipped (vetoed):                                  " << n_vetoed << std::endl;
+            out << "  evaluated anyway to check the vetoes:              " << n_audits << std::endl;
+            out << "    of which reached the threshold:                  " << n_false_vetoes << std::endl;
+            out << "  estimated fraction of wrong vetoes:                " << false_rate << " +/- " << false_err << std::endl;
+            out << "Evaluated points compared with their prediction:     " << n_compared << std::endl;
+            if (n_compared > 0)
+            {
+                const double mz = sum_z/n_compared;
+                out << "  mean of (value - prediction)/sd:                   " << mz << " (ideally 0)" << std::endl;
+                out << "  standard deviation of (value - prediction)/sd:     " << std::sqrt(std::max(sum_z2/n_compared - mz*mz, 0.)) << " (ideally 1)" << std::endl;
+                out << "  fraction within 1 sd of the prediction:            " << double(n_within_1sigma)/n_compared << " (ideally 0.68)" << std::endl;
+                out << "  fraction below prediction + " << nsigma << " sd:                  " << double(n_covered)/n_compared << std::endl;
+            }
+            out << "Model fits:                                          " << nfits << std::endl;
+            out << "  training points:                                   " << fit_x.size() << std::endl;
+            out << "  length scale (unit hypercube):                     " << length << std::endl;
+            out.close();
+
+            std::cout << "Rank " << rank << ": surrogate pre-screening of " << purpose << " skipped " << n_vetoed << " of "
+                      << n_screened << " predicted points; " << n_false_vetoes << " of " << n_audits
+                      << " checked vetoes were wrong.  Calibration report written to " << filename << std::endl;
+        }
+
+    }
+
+}
@@ -172,8 +172,27 @@ namespace Gambit
         scan_err << "Invalid input to DoubleLogFlatJoin prior (in 'transform'): Input parameters must be a vector of size 1! (has size=" << unitpars.size() << ")" << scan_end;
       }
 
+      output[myparameter] = transform_value(unitpars[0]);
+    }
+
+    /// Transformation from unit interval to the double log + flat join, into an array
+    void DoubleLogFlatJoin::transform_array(const double *unit, double *physical) const
+    {
+      if (output_index[0] != unused_index) physical[output_index[0]] = transform_value(unit[0]);
+    }
+
+    /// Transformation from unit interval to the double log + flat join, for a batch of points
+    void DoubleLogFlatJoin::transform_batch(const double *unit, double *physical, size_t n) const
+    {
+      if (output_index[0] == unused_index) return;
+      double *out = physical + output_index[0]*n;
+      for (size_t k = 0; k < n; k++) out[k] = transform_value(unit[k]);
+    }
+
+    /// Transformation of a single unit cube value r
+    double DoubleLogFlatJoin::transform_value(double r) const
+    {
       double x = 0; // output (result)
-      double r = unitpars[0]; // input unit cube parameter
       double x0 = lower;
       double x1 = flat_start;
       double x2 = flat_end;
@@ -199,7 +218,7 @@ namespace Gambit
         scan_err << "Problem transforming r-value for DoubleLogFlatJoin (received "<<r<<")!" << scan_end;
       }
 
-      output[myparameter] = x;
+      return x;
     }
 
     std::vector<double> DoubleLogFlatJoin::inverse_transform(const std::unordered_map<std::string, double> &physical) const
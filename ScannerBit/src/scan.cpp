@@ -170,6 +170,13 @@ namespace Gambit
                 plugin_interface();
             }
 
+            // Collect any lnlike thresholds still in flight between processes (COLLECTIVE OPERATION)
+            #ifdef WITH_MPI
+            Plugins::plugin_info.finish_lnlike_threshold_messages();
+            #endif
+
+            Plugins::plugin_info.prescreen_report();
+
             // Check shutdown flags across all processes (COLLECTIVE OPERATION)
             #ifdef WITH_MPI
             if(rank==0) cout << "ScannerBit is waiting for all MPI processes to report their shutdown condition..." << endl;
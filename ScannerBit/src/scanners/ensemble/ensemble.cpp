@@ -0,0 +1,321 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Affine-invariant ensemble sampler.
+///
+///  The walkers are split into two halves.  All
+///  walkers in one half are moved at once, using
+///  the (fixed) positions of the other half, so
+///  each process moves its own share of the half
+///  and the processes only communicate once per
+///  half-ensemble update.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#ifdef WITH_MPI
+#include "gambit/Utils/begin_ignore_warnings_mpi.hpp"
+#include "mpi.h"
+#include "gambit/Utils/end_ignore_warnings.hpp"
+#endif
+
+#include <cmath>
+#include <chrono>
+#include <random>
+#include <limits>
+#include <fstream>
+#include <iostream>
+#include <algorithm>
+
+#include "plugin_interface.hpp"
+#include "scanner_plugin.hpp"
+#include "ensemble.hpp"
+
+scanner_plugin(ensemble, version(1, 0, 0))
+{
+    int plugin_main ()
+    {
+        like_ptr LogLike = get_purpose(get_inifile_value<std::string>("like", "LogLike"));
+
+        // Do not allow GAMBIT's own likelihood calculator to directly shut down the scan.
+        // The sampler stops all processes together at the end of a half-ensemble update instead,
+        // triggered by the 'plugin_info.early_shutdown_in_progress()' function.
+        LogLike->disable_external_shutdown();
+
+        int dim = get_dimension();
+        int numtasks = set_resume_params.NumTasks();
+
+        Gambit::Options txt_options;
+        txt_options.setValue("synchronised",false);
+        get_printer().new_stream("txt", txt_options);
+        set_resume_params.set_resume_mode(get_printer().resume_mode());
+
+        // Each half of the ensemble must be shared out evenly between the processes.
+        int unit = 2*numtasks;
+        int nwalkers = get_inifile_value<int>("walkers", 4*dim);
+        nwalkers = std::max(unit, (nwalkers + unit - 1)/unit*unit);
+
+        AffineEnsemble(LogLike, get_printer(),
+                       set_resume_params,
+                       dim,
+                       nwalkers,
+                       get_inifile_value<double>("stretch", 2.0),
+                       get_inifile_value<long long>("steps", 1000),
+                       get_inifile_value<long long>("ran_seed", -1),
+                       get_inifile_value<int>("save_freq", 100),
+                       get_inifile_value<double>("timeout_mins", -1)
+                      );
+
+        return 0;
+    }
+}
+
+
+namespace Gambit
+{
+    namespace Scanner
+    {
+        struct ensemble_point_info
+        {
+            int mult;
+            int walker;
+            int rank;
+            unsigned long long int id;
+        };
+
+        void AffineEnsemble(Gambit::Scanner::like_ptr LogLike,
+                            Gambit::Scanner::printer_interface &printer,
+                            Gambit::Scanner::resume_params_func set_resume_params,
+                            const int &dimension,
+                            const int &nwalkers,
+                            const double &stretch,
+                            const long long &nsteps,
+                            const long long &seed,
+                            const int &save_freq,
+                            const double &mins_max)
+        {
+            const int rank = set_resume_params.Rank();
+            const int numtasks = set_resume_params.NumTasks();
+            const int half = nwalkers/2;
+            // Number of walkers in each half moved by each process
+            const int share = half/numtasks;
+
+            // State of the whole ensemble (identical on all processes between half-ensemble updates)
+            std::vector<double> pos(nwalkers*dimension);
+            std::vector<double> lnlike(nwalkers, -std::numeric_limits<double>::max());
+            std::vector<unsigned long long int> ids(nwalkers, 0);
+            // Number of steps for which each walker of this process has stayed at its current point
+            std::vector<int> mult(nwalkers, 0);
+            long long step = 0, naccept = 0, nproposed = 0;
+            int next_half = 0;
+            bool resumed = false;
+
+            set_resume_params(pos, lnlike, ids, mult, step, naccept, nproposed, next_half, resumed);
+
+            Gambit::Scanner::assign_aux_numbers("mult", "chain");
+
+            // Seed differently on each process, and on each resumption of the run.
+            std::seed_seq seeds{(unsigned long long)(seed < 0 ? std::random_device()() : seed), (unsigned long long)rank, (unsigned long long)step};
+            std::mt19937_64 rng(seeds);
+            std::uniform_real_distribution<double> uniform(0.0, 1.0);
+            std::vector<double> y(dimension);
+
+            std::chrono::time_point<std::chrono::system_clock> start = std::chrono::system_clock::now();
+
+            // Multiplicities of finished points are saved to a temporary file, and printed at the end of the run.
+            std::ofstream temp_file_out;
+            str filename = set_resume_params.get_temp_file_name("temp");
+            temp_file_out.open(filename, std::ofstream::binary | std::ofstream::app);
+            if (not temp_file_out.is_open()) scan_error().raise(LOCAL_INFO, "Problem opening temp file " + filename + " in the ensemble sampler!");
+
+            // Gather the walkers of the given half that each process has just updated, so that every process has all of them
+            auto exchange = [&](int h)
+            {
+                #ifdef WITH_MPI
+                    MPI_Allgather(MPI_IN_PLACE, 0, MPI_DATATYPE_NULL, &pos[h*half*dimension], share*dimension, MPI_DOUBLE, MPI_COMM_WORLD);
+                    MPI_Allgather(MPI_IN_PLACE, 0, MPI_DATATYPE_NULL, &lnlike[h*half], share, MPI_DOUBLE, MPI_COMM_WORLD);
+                    MPI_Allgather(MPI_IN_PLACE, 0, MPI_DATATYPE_NULL, &ids[h*half], share, MPI_UNSIGNED_LONG_LONG, MPI_COMM_WORLD);
+                #else
+                    (void)h;
+                #endif
+            };
+
+            // Agree between all processes whether to stop: 1 for early shutdown, 2 for the time limit
+            auto stop_signal = [&](int stop)
+            {
+                #ifdef WITH_MPI
+                    MPI_Allreduce(MPI_IN_PLACE, &stop, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+                #endif
+                return stop;
+            };
+
+            int stop = 0;
+
+            if (not resumed)
+            {
+                // Start the walkers of this process at random points in the unit hypercube.
+                for (int h = 0; h < 2 and not stop; h++)
+                {
+                    for (int k = h*half + rank*share; k < h*half + (rank+1)*share; k++)
+                    {
+                        for (int j = 0; j < dimension; j++) y[j] = pos[k*dimension + j] = uniform(rng);
+                        lnlike[k] = LogLike(y);
+                        ids[k] = LogLike->getPtID();
+                        if (Gambit::Scanner::Plugins::plugin_info.early_shutdown_in_progress())
+                        {
+                            stop = 1;
+                            break;
+                        }
+                    }
+                    stop = stop_signal(stop);
+                    exchange(h);
+                }
+                if (stop)
+                {
+                    std::cout << "Rank " << rank << ": quit signal received during initialisation of the ensemble sampler, aborting run." << std::endl;
+                    temp_file_out.close();
+                    return;
+                }
+                resumed = true;
+            }
+
+            if (rank == 0)
+            {
+                std::cout << "Affine-invariant ensemble sampler started with " << nwalkers << " walkers ("
+                          << share << " per process in each half)." << std::endl;
+            }
+
+            while (step < nsteps and not stop)
+            {
+                // A half interrupted by early shutdown still counts as done, as its new positions have been shared.
+                for (; next_half < 2 and not stop; next_half++)
+                {
+                    const int h = next_half;
+                    const int other = (1 - h)*half;
+
+                    // Move each walker of this process in this half, by stretching it away from or towards a
+                    // random walker in the other half.
+                    for (int k = h*half + rank*share; k < h*half + (rank+1)*share and not stop; k++)
+                    {
+                        const int j = other + std::min(half - 1, int(half*uniform(rng)));
+                        const double u = (stretch - 1.0)*uniform(rng) + 1.0;
+                        const double z = u*u/stretch;
+                        for (int d = 0; d < dimension; d++)
+                        {
+                            y[d] = pos[j*dimension + d] + z*(pos[k*dimension + d] - pos[j*dimension + d]);
+                        }
+
+                        // Proposals outside the prior have zero probability, so they are not evaluated.
+                        if (outsideUnitCube(y)) continue;
+
+                        const double lnlike_y = LogLike(y);
+                        const unsigned long long int id_y = LogLike->getPtID();
+                        const double lnq = (dimension - 1)*std::log(z) + lnlike_y - lnlike[k];
+                        nproposed++;
+
+                        if (lnq >= 0.0 or std::log(uniform(rng)) < lnq)
+                        {
+                            ensemble_point_info info = {mult[k], k, rank, ids[k]};
+                            temp_file_out.write((char *)&info, sizeof(ensemble_point_info));
+                            std::copy(y.begin(), y.end(), pos.begin() + k*dimension);
+                            lnlike[k] = lnlike_y;
+                            ids[k] = id_y;
+                            mult[k] = 0;
+                            naccept++;
+                        }
+                        else
+                        {
+                            ensemble_point_info info = {0, -1, rank, id_y};
+                            temp_file_out.write((char *)&info, sizeof(ensemble_point_info));
+                        }
+
+                        if (Gambit::Scanner::Plugins::plugin_info.early_shutdown_in_progress()) stop = 1;
+                    }
+
+                    if (h == 1 and not stop and mins_max > 0)
+                    {
+                        std::chrono::duration<double> runtime = std::chrono::system_clock::now() - start;
+                        if (runtime.count()/60.0 >= mins_max) stop = 2;
+                    }
+
+                    // The only communication in the update: share the new positions of this half.
+                    stop = stop_signal(stop);
+                    exchange(h);
+                }
+
+                if (next_half < 2) break;
+                next_half = 0;
+                step++;
+                for (int h = 0; h < 2; h++)
+                {
+                    for (int k = h*half + rank*share; k < h*half + (rank+1)*share; k++) mult[k]++;
+                }
+
+                if (step % save_freq == 0) set_resume_params.dump();
+
+                if (step % 100 == 0 or step == nsteps or stop == 2)
+                {
+                    long long totals[2] = {naccept, nproposed};
+                    #ifdef WITH_MPI
+                        MPI_Allreduce(MPI_IN_PLACE, totals, 2, MPI_LONG_LONG, MPI_SUM, MPI_COMM_WORLD);
+                    #endif
+                    if (rank == 0)
+                    {
+                        std::cout << "Ensemble step " << step << " of " << nsteps << std::endl;
+                        std::cout << "\tAcceptance ratio = " << (totals[1] > 0 ? double(totals[0])/double(totals[1]) : 0.0) << std::endl;
+                    }
+                }
+
+                if (stop == 2 and rank == 0)
+                {
+                    std::cout << "Ensemble sampler reached requested time limit of " << mins_max << " minutes.  Finalising run now." << std::endl;
+                }
+            }
+
+            if (stop == 1)
+            {
+                std::cout << "Rank " << rank << ": ensemble sampler received quit signal! Writing resume data." << std::endl;
+                set_resume_params.dump();
+            }
+            else
+            {
+                // The run is complete, so the current points of the walkers of this process get their final weights.
+                for (int h = 0; h < 2; h++)
+                {
+                    for (int k = h*half + rank*share; k < h*half + (rank+1)*share; k++)
+                    {
+                        ensemble_point_info info = {mult[k], k, rank, ids[k]};
+                        temp_file_out.write((char *)&info, sizeof(ensemble_point_info));
+                    }
+                }
+            }
+
+            temp_file_out.close();
+            Gambit::Scanner::printer *out_stream = printer.get_stream("txt");
+            std::ifstream temp_file_in(filename.c_str(), std::ifstream::binary);
+            ensemble_point_info info;
+            while (temp_file_in.read((char *)&info, sizeof(ensemble_point_info)))
+            {
+                out_stream->print(info.mult, "mult", info.rank, info.id);
+                out_stream->print(info.walker, "chain", info.rank, info.id);
+            }
+            out_stream->flush();
+            temp_file_in.close();
+
+            // Start the temporary file afresh, so that these points are not printed again if the run is resumed.
+            temp_file_out.open(filename, std::ofstream::binary | std::ofstream::trunc);
+            temp_file_out.close();
+
+            std::cout << "Ensemble sampler has finished in process " << rank << "." << std::endl;
+        }
+
+    }
+
+}
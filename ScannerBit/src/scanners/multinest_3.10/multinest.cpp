@@ -22,6 +22,8 @@
 #include <map>
 #include <sstream>
 #include <iomanip>  // For debugging only
+#include <limits>
+#include <algorithm>
 
 #include "gambit/ScannerBit/scanner_plugin.hpp"
 #include "gambit/ScannerBit/scanners/multinest/multinest.hpp"
@@ -106,6 +108,7 @@ scanner_plugin(multinest, version(3, 10))
       int outfile (get_inifile_value<bool>("outfile", true) );  // write output files?
       double ln0 (get_inifile_value<double>("logZero",0.9999*gl0)); // points with loglike < logZero will be ignored by MultiNest
       int maxiter (get_inifile_value<int>("maxiter", 0) );      // Max no. of iterations, a non-positive value means infinity.
+      bool lnlike_threshold (get_inifile_value<bool>("use_lnlike_threshold", false) ); // let the likelihood skip components for points that cannot beat the worst live point?
       int initMPI(0);                                           // Initialise MPI in ScannerBit, not in MultiNest
       void *context = 0;                                        // any additional information user wants to pass (not required by MN)
       // Which parameters to have periodic boundary conditions?
@@ -157,7 +160,7 @@ scanner_plugin(multinest, version(3, 10))
       Gambit::Scanner::assign_aux_numbers("Posterior","LastLive");
 
       // Create the object that interfaces to the MultiNest LogLike callback function
-      Gambit::MultiNest::LogLikeWrapper loglwrapper(LogLike, get_printer());
+      Gambit::MultiNest::LogLikeWrapper loglwrapper(LogLike, get_printer(), lnlike_threshold);
       Gambit::MultiNest::global_loglike_object = &loglwrapper;
 
       //Run MultiNest, passing callback functions for the loglike and dumper.
@@ -205,8 +208,8 @@ namespace Gambit {
 
 
       /// LogLikeWrapper Constructor
-      LogLikeWrapper::LogLikeWrapper(scanPtr loglike, printer_interface& printer)
-        : boundLogLike(loglike), boundPrinter(printer), dumper_runonce(false)
+      LogLikeWrapper::LogLikeWrapper(scanPtr loglike, printer_interface& printer, bool use_lnlike_threshold)
+        : boundLogLike(loglike), boundPrinter(printer), dumper_runonce(false), use_lnlike_threshold(use_lnlike_threshold)
       { }
 
       /// Main interface function from MultiNest to ScannerBit-supplied loglikelihood function
@@ -258,7 +261,10 @@ namespace Gambit {
       /// physLive[1][nlive * (nPar + 1)]                      = 2D array containing the last set of live points
       ///                                                        (physical parameters plus derived parameters) along
       ///                                                        with their loglikelihood values
-      /// TODO: Multinest uses the likelihood of the lowest live point as the "threshold" for iterating, i.e. it throws out the live point if it finds a better one. So we can use this number to update the GAMBIT 'cutoff' threshold when evaluating the likelihood function.
+      ///                                                        Multinest uses the likelihood of the lowest live point as the
+      ///                                                        threshold for iterating, i.e. it throws out the live point if
+      ///                                                        it finds a better one. If use_lnlike_threshold is set, we pass
+      ///                                                        this on to the likelihood function as its cutoff.
 
       /// posterior[1][nSamples * (nPar + 2)]                  = posterior distribution containing nSamples points.
       ///                                                        Each sample has nPar parameters (physical + derived)
@@ -301,6 +307,15 @@ namespace Gambit {
              std::cerr << "Multinest dumper first ran on process "<<boundLogLike->getRank()<<" at iteration "<<boundLogLike->getPtID()<<std::endl;
           }
 
+          // Tell the likelihood function that points worse than the lowest live point will be thrown out anyway.
+          // The threshold only increases as the run progresses, so it is safe for it to be a little out of date.
+          if (use_lnlike_threshold)
+          {
+             double min_live_LogL = std::numeric_limits<double>::infinity();
+             for( int i = 0; i < nlive; i++ ) min_live_LogL = std::min(min_live_LogL, physLive[nPar*nlive + i]);
+             boundLogLike.set_lnlike_threshold(min_live_LogL);
+          }
+
           // Get printers for each auxiliary stream
           //printer* stats_stream( boundPrinter.get_stream("stats") ); //FIXME see below
           printer* txt_stream(   boundPrinter.get_stream("txt")   );
@@ -129,34 +129,45 @@ scanner_plugin(polychord, version(1, 18, 2))
           scan_error().raise(LOCAL_INFO,error_message);
       }
 
+      // Sort the parameters into grades, from slow to fast. If fast parameters have not been specified
+      // explicitly, the grading is worked out from the likelihood's functor timings (unless
+      // use_speed_hierarchy is switched off).
+      std::vector<std::vector<std::string>> grades;
+      if (fast_params.empty() and get_inifile_value<bool>("use_speed_hierarchy", true))
+      {
+          grades = LogLike.get_speed_hierarchy(get_inifile_value<double>("speed_ratio", 10.));
+      }
+      else
+      {
+          grades.resize(2);
+          for (auto param : varied_params)
+              grades[std::find(fast_params.begin(), fast_params.end(), param) == fast_params.end() ? 0 : 1].push_back(param);
+      }
+
       // Compute the locations in PolyChord's unit hypercube, ordering from slow to fast
-      // This defaults to nDims if there are no fast parameters, or if all parameters are fast.
-      // grade_dims is a vector of integers that indicates the number of slow and fast parameters
+      // grade_dims is a vector of integers that indicates the number of parameters in each grade
       settings.grade_dims.clear();
       unsigned int i = 0;
-      // Run through all the parameters, and if they're slow parameters
-      // give them an index i, then increment i
-      for (auto param : varied_params)
-          if (std::find(fast_params.begin(), fast_params.end(),param) == fast_params.end())
-              Gambit::PolyChord::global_loglike_object->index_map[param] = (i++);
-      unsigned int nslow = i;
-      if(nslow!=0) settings.grade_dims.push_back(nslow);
-
-      // Do the same for the fast parameters
-      for (auto param : varied_params)
-          if (std::find(fast_params.begin(), fast_params.end(),param) != fast_params.end())
-              Gambit::PolyChord::global_loglike_object->index_map[param] = (i++);
-      unsigned int nfast = i-nslow;
-      if (nfast>0) settings.grade_dims.push_back(nfast);
-
-      if (nslow>0 and nfast>0)
+      for (auto& grade : grades)
+      {
+          if (grade.empty()) continue;
+          for (auto param : grade) Gambit::PolyChord::global_loglike_object->index_map[param] = (i++);
+          settings.grade_dims.push_back(grade.size());
+      }
+      unsigned int nslow = (settings.grade_dims.empty() ? 0 : settings.grade_dims[0]);
+
+      if (settings.grade_dims.size() > 1)
       {
-          // Specify the fraction of time to spend in the slow parameters.
+          // Specify the fraction of time to spend in each grade. By default the slowest grade
+          // gets frac_slow and the others share the rest equally.
           double frac_slow = get_inifile_value<double>("frac_slow",0.75);
-          settings.grade_frac = std::vector<double>({frac_slow, 1-frac_slow});
+          unsigned int nfast_grades = settings.grade_dims.size() - 1;
+          std::vector<double> default_frac(1, frac_slow);
+          default_frac.resize(settings.grade_dims.size(), (1-frac_slow)/nfast_grades);
+          settings.grade_frac = get_inifile_value<std::vector<double>>("grade_frac", default_frac);
+          if (settings.grade_frac.size() != settings.grade_dims.size())
+              scan_error().raise(LOCAL_INFO, "The number of entries in grade_frac does not match the number of parameter grades.");
       }
-      else if (nslow==0) // In the unusual case of all fast parameters, there's only one grade.
-          nslow = nfast;
       // ---------- End computation of ordering for fast and slow parameters
 
       // PolyChord algorithm options.
@@ -188,6 +188,10 @@ scanner_plugin(postprocessor, version(2, 0, 0))
 
     // Size of chunks to be distributed to worker processes
     settings.chunksize = get_inifile_value<std::size_t>("batch_size",1);
+    if(settings.chunksize==0) settings.chunksize = 1;
+
+    // Largest chunk to hand out while plenty of work remains (chunks shrink towards batch_size near the end)
+    settings.max_chunksize = std::max(settings.chunksize, get_inifile_value<std::size_t>("max_batch_size",100*settings.chunksize));
 
     // Finally, there is the 'Purpose' value of the likelihood container. This may well clash
     // with the old name used in the input file, so better check for this and make the user
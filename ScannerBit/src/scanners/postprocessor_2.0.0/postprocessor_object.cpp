@@ -35,19 +35,13 @@ namespace Gambit
       /// @{ Helper functions for performing resume related tasks
 
       /// Answer queries as to whether a given dataset index has been postprocessed in a previous run or not
-      bool point_done(const ChunkSet done_chunks, size_t index)
+      bool point_done(const ChunkSet& done_chunks, size_t index)
       {
-        bool answer = false;
-        for(ChunkSet::const_iterator it=done_chunks.begin();
-             it!=done_chunks.end(); ++it)
-        {
-           if(it->iContain(index))
-           {
-              answer = true;
-              break;
-           }
-        }
-        return answer;
+        // Find the last chunk starting at or before index; it is the only one that can contain it.
+        ChunkSet::const_iterator it = done_chunks.upper_bound(Chunk(index,index));
+        if(it==done_chunks.begin()) return false;
+        --it;
+        return it->iContain(index);
       }
 
       /// Get 'effective' start and end positions for a processing batch
@@ -228,6 +222,8 @@ namespace Gambit
         , total_length()
         , next_point(0)
         , chunksize()
+        , max_chunksize()
+        , remaining_points()
         , done_chunks()
         , all_params()
         , data_labels()
@@ -244,6 +240,7 @@ namespace Gambit
         , reweighted_loglike_name()
         , root()
         , rank()
+        , numtasks()
         #ifdef WITH_MPI
         , comm(NULL)
         #endif
@@ -266,6 +263,8 @@ namespace Gambit
         , total_length(getReader().get_dataset_length())
         , next_point(0)
         , chunksize(o.chunksize)
+        , max_chunksize(o.max_chunksize)
+        , remaining_points(total_length+1)
         , done_chunks()
         , all_params                 (o.all_params                 )
         , data_labels                (o.data_labels                )
@@ -282,6 +281,7 @@ namespace Gambit
         , reweighted_loglike_name    (o.reweighted_loglike_name    )
         , root                       (o.root                       )
         , rank                       (o.rank                       )
+        , numtasks                   (o.numtasks                   )
         #ifdef WITH_MPI
         , comm                       (o.comm                       )
         #endif
@@ -652,6 +652,9 @@ namespace Gambit
          }
          else
          {
+            // Size the reader's buffers to this chunk rather than reading past its end
+            getReader().set_read_range(mychunk.start, mychunk.end);
+
             PPIDpair current_point = getReader().get_current_point();
             loopi = getReader().get_current_index();
 
@@ -1137,7 +1140,16 @@ namespace Gambit
       // Define the set of points that can be auto-skipped
       void PPDriver::set_done_chunks(const ChunkSet& in_done_chunks)
       {
-         done_chunks = in_done_chunks;
+         // Merge so that each point can be looked up in a single chunk
+         done_chunks = merge_chunks(in_done_chunks);
+
+         // Count the points that still need processing
+         remaining_points = total_length+1;
+         for(ChunkSet::const_iterator it=done_chunks.begin(); it!=done_chunks.end(); ++it)
+         {
+            if(it->start > total_length) break;
+            remaining_points -= std::min<std::size_t>(it->end, total_length) - it->start + 1;
+         }
       }
 
       /// Compute start/end indices for a given rank process, given previous "done_chunk" data.
@@ -1149,6 +1161,11 @@ namespace Gambit
          bool stop = false;
          bool found_start = false;
 
+         // Size of this chunk: large while plenty of work remains, to keep the number of requests
+         // down, then shrinking towards chunksize so that all workers finish at about the same time.
+         unsigned long long nworkers = (numtasks > 1 ? numtasks - 1 : 1);
+         unsigned long long this_chunksize = std::max(chunksize, std::min(max_chunksize, remaining_points / (2*nworkers)));
+
          if(next_point > total_length)
          {
             // Do nothing, no points left to process. Return special stop-signal chunk.
@@ -1161,13 +1178,8 @@ namespace Gambit
             // through the dataset, but skipping points that have already been processed.
             while(not stop)
             {
-               bool point_is_done = false;
-               for(ChunkSet::const_iterator donechunk=done_chunks.begin();
-                    donechunk!=done_chunks.end(); ++donechunk)
-               {
-                  // Check if the next scheduled point has been processed previously
-                  if(donechunk->iContain(next_point)) point_is_done = true;
-               }
+               // Check if the next scheduled point has been processed previously
+               bool point_is_done = point_done(done_chunks, next_point);
 
                if(not point_is_done)
                {
@@ -1185,7 +1197,7 @@ namespace Gambit
                   chunk_end = total_length;
                   stop = true;
                }
-               else if(chunk_length == chunksize)
+               else if(chunk_length == this_chunksize)
                {
                   // Chunk contains enough unprocessed points; stop adding more.
                   chunk_end = next_point;
@@ -1197,7 +1209,7 @@ namespace Gambit
                   err << "Error generating chunk to be processed; next_point exceeds total length of dataset. Something has gone wrong for this to happen, please report this as a postprocessor bug." << std::endl;
                   Scanner::scan_error().raise(LOCAL_INFO,err.str());
                }
-               else if(chunk_length > chunksize)
+               else if(chunk_length > this_chunksize)
                {
                   std::ostringstream err;
                   err << "Error generating chunk to be processed; length of generated chunk exceeds allocated size. Something has gone wrong for this to happen, please report this as a postprocessor bug." << std::endl;
@@ -1208,6 +1220,8 @@ namespace Gambit
             }
          }
 
+         remaining_points -= std::min<unsigned long long>(chunk_length, remaining_points);
+
          // Return to the chunk to be processed
          //std::cout<<"chunk_start :"<<chunk_start<<std::endl;
          //std::cout<<"chunk_end   :"<<chunk_end<<std::endl;
@@ -27,6 +27,7 @@
 #include <sstream>
 
 #include "gambit/ScannerBit/scanner_plugin.hpp"
+#include "gambit/ScannerBit/task_dispatcher.hpp"
 
 inline std::vector<std::unordered_set<std::string>> parse_sames(const std::vector<std::string> &params)
 {
@@ -61,16 +62,6 @@ scanner_plugin(grid, version(1, 0, 0))
     int plugin_main()
     {
         int ma = get_dimension();
-        int numtasks;
-        int rank;
-        
-#ifdef WITH_MPI
-        MPI_Comm_size(MPI_COMM_WORLD, &numtasks);
-        MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-#else
-        numtasks = 1;
-        rank = 0;
-#endif
 
         std::vector<int> N = get_inifile_value<std::vector<int>>("grid_pts");
         int NTot = 1;
@@ -141,7 +132,12 @@ scanner_plugin(grid, version(1, 0, 0))
         LogLike = get_purpose(get_inifile_value<std::string>("like"));
         std::vector<double> vec(ma, 0.0);
 
-        for (int i = rank, end = NTot; i < end; i+=numtasks)
+        bool dynamic = get_inifile_value<bool>("dynamic_dispatch", false);
+        if (dynamic) LogLike->disable_external_shutdown();
+        Gambit::Scanner::task_dispatcher tasks(NTot, dynamic, get_inifile_value<unsigned long long>("batch_size", 1));
+
+        unsigned long long i;
+        while (tasks.next(i))
         {
             int n = i;
             for (int j = 0; j < ma; j++)
@@ -155,6 +151,9 @@ scanner_plugin(grid, version(1, 0, 0))
             }
 
             LogLike(vec);
+
+            if (dynamic and Gambit::Scanner::Plugins::plugin_info.early_shutdown_in_progress())
+                tasks.quit();
         }
 
         return 0;
@@ -0,0 +1,72 @@
+//  GAMBIT: Global and Modular BSM Inference Tool
+//  *********************************************
+///  \file
+///
+///  Latin hypercube sampler.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#include <vector>
+#include <string>
+#include <iostream>
+
+#include "gambit/ScannerBit/scanner_plugin.hpp"
+#include "low_discrepancy.hpp"
+
+scanner_plugin(latin_hypercube, version(1, 0, 0))
+{
+    int plugin_main ()
+    {
+        like_ptr LogLike = get_purpose(get_inifile_value<std::string>("like"));
+
+        // Stop at the next point on early shutdown, so that the resume data record exactly the points done.
+        LogLike->disable_external_shutdown();
+
+        int dim = get_dimension();
+        int rank = set_resume_params.Rank();
+        int numtasks = set_resume_params.NumTasks();
+        unsigned int num = get_inifile_value<unsigned int>("point_number", 1000);
+        unsigned long long seed = get_inifile_value<unsigned long long>("ran_seed", 0);
+        bool centred = get_inifile_value<bool>("centred", false);
+        if (num == 0) scan_err << "Latin hypercube sampler: point_number must be positive." << scan_end;
+
+        // Number of points evaluated by this process so far
+        unsigned long long done = 0;
+        set_resume_params.set_resume_mode(get_printer().resume_mode());
+        set_resume_params(done);
+
+        // Every process works out the same design, and takes every numtasks-th point of it.
+        std::vector<double> a(dim);
+
+        if (rank == 0)
+        {
+            std::cout << "Entering Latin hypercube sampler." << "\n\tnumber of points to calculate:  " << num << std::endl;
+        }
+
+        for (unsigned long long k = rank + done*numtasks; k < num; k += numtasks)
+        {
+            Gambit::Scanner::latin_hypercube_point(k, num, seed, centred, a);
+            LogLike(a);
+            done++;
+
+            if (rank == 0 and done%1000 == 0)
+                std::cout << "points:  " << k + 1 << " / " << num << std::endl;
+
+            if (Gambit::Scanner::Plugins::plugin_info.early_shutdown_in_progress())
+            {
+                std::cout << "Rank " << rank << ": Latin hypercube sampler received quit signal after " << done << " points. Writing resume data." << std::endl;
+                set_resume_params.dump();
+                break;
+            }
+        }
+
+        return 0;
+    }
+}
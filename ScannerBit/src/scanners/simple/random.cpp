@@ -25,18 +25,22 @@
 #include <iostream>
 
 #include "gambit/ScannerBit/scanner_plugin.hpp"
+#include "gambit/ScannerBit/task_dispatcher.hpp"
 #include "gambit/Utils/threadsafe_rng.hpp"
   
 scanner_plugin(random, version(1, 0, 0))
 {
     like_ptr LogLike;
     int num, dim, numtasks, rank;
+    bool dynamic;
     
     plugin_constructor
     {
         LogLike = get_purpose(get_inifile_value<std::string>("like"));
         num = get_inifile_value<int>("point_number", 10);
         dim = get_dimension();
+        dynamic = get_inifile_value<bool>("dynamic_dispatch", false);
+        if (dynamic) LogLike->disable_external_shutdown();
         
 #ifdef WITH_MPI
         MPI_Comm_size(MPI_COMM_WORLD, &numtasks);
@@ -53,16 +57,24 @@ scanner_plugin(random, version(1, 0, 0))
 
         std::cout << "Entering random sampler." << "\n\tnumber of points to calculate:  " << num << std::endl;
         
-        for (int k = 0; k < num; k++)
+        // With dynamic dispatch, point_number is the total over all processes; otherwise each process does point_number points.
+        unsigned long long total = dynamic ? num : (unsigned long long)num*numtasks;
+        Gambit::Scanner::task_dispatcher tasks(total, dynamic, get_inifile_value<unsigned long long>("batch_size", 1));
+        unsigned long long k;
+        
+        while (tasks.next(k))
         {
-            for (int i = rank; i < dim; i+=numtasks)
+            for (int i = 0; i < dim; i++)
             {
                 a[i] = Gambit::Random::draw();
             }
             LogLike(a);
             
             if (k%1000 == 0)
-                std::cout << "points:  " << k << " / " << num << std::endl;
+                std::cout << "points:  " << k << " / " << total << std::endl;
+            
+            if (dynamic and Gambit::Scanner::Plugins::plugin_info.early_shutdown_in_progress())
+                tasks.quit();
         }
         
         return 0;
@@ -28,12 +28,13 @@
 #include <sstream>
 
 #include "gambit/ScannerBit/scanner_plugin.hpp"
+#include "gambit/ScannerBit/task_dispatcher.hpp"
 #include "gambit/Utils/threadsafe_rng.hpp"
 
 scanner_plugin(raster, version(1, 0, 0))
 {
     std::map<std::string, std::vector<double>> param_map;
-    int N = 0, numtasks, rank;
+    int N = 0;
     
     plugin_constructor
     {
@@ -56,14 +57,6 @@ scanner_plugin(raster, version(1, 0, 0))
             if (temp > N)
                 N = temp;
         }
-        
-#ifdef WITH_MPI
-        MPI_Comm_size(MPI_COMM_WORLD, &numtasks);
-        MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-#else
-        numtasks = 1;
-        rank = 0;
-#endif
     }
 
     int plugin_main (void)
@@ -74,7 +67,12 @@ scanner_plugin(raster, version(1, 0, 0))
 
         std::cout << "Starting Raster Scanner over " << N << " points." << ma << std::endl;
 
-        for (int i = rank; i < N; i+=numtasks)
+        bool dynamic = get_inifile_value<bool>("dynamic_dispatch", false);
+        if (dynamic) LogLike->disable_external_shutdown();
+        Gambit::Scanner::task_dispatcher tasks(N, dynamic, get_inifile_value<unsigned long long>("batch_size", 1));
+
+        unsigned long long i;
+        while (tasks.next(i))
         {
             std::unordered_map<std::string, double> map;
             for (auto it = param_map.begin(), end = param_map.end(); it != end; ++it)
@@ -89,6 +87,9 @@ scanner_plugin(raster, version(1, 0, 0))
 
             LogLike(map, a);
             std::cout << "Point " << i << " done." << std::endl;
+
+            if (dynamic and Gambit::Scanner::Plugins::plugin_info.early_shutdown_in_progress())
+                tasks.quit();
         }
         
         std::cout << "Finished!" << std::endl;
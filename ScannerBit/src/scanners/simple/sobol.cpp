@@ -0,0 +1,90 @@
+//  GAMBIT: Global and Modular BSM Inference Tool
+//  *********************************************
+///  \file
+///
+///  Scrambled Sobol sampler.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <algorithm>
+
+#include "gambit/ScannerBit/scanner_plugin.hpp"
+#include "low_discrepancy.hpp"
+
+scanner_plugin(sobol, version(1, 0, 0))
+{
+    int plugin_main ()
+    {
+        like_ptr LogLike = get_purpose(get_inifile_value<std::string>("like"));
+
+        // Stop at the next point on early shutdown, so that the resume data record exactly the points done.
+        LogLike->disable_external_shutdown();
+
+        int dim = get_dimension();
+        int rank = set_resume_params.Rank();
+        int numtasks = set_resume_params.NumTasks();
+        unsigned long long num = get_inifile_value<unsigned long long>("point_number", 1024);
+        unsigned long long first = get_inifile_value<unsigned long long>("start_index", 0);
+
+        // Number of points evaluated by this process so far
+        unsigned long long done = 0;
+        set_resume_params.set_resume_mode(get_printer().resume_mode());
+        set_resume_params(done);
+
+        // Every process makes the same sequence, and takes every numtasks-th point of it.
+        Gambit::Scanner::sobol_sequence sobol(dim, get_inifile_value<bool>("scramble", true), get_inifile_value<unsigned long long>("ran_seed", 0));
+
+        // The prior transforms are done batch_size points at a time, in structure-of-arrays layout.
+        const unsigned long long batch = std::max(1ULL, get_inifile_value<unsigned long long>("batch_size", 64));
+        const size_t npar = LogLike.get_all_names().size();
+        std::vector<std::vector<double>> points(batch, std::vector<double>(dim));
+        std::vector<double> unit(dim*batch), physical(npar*batch);
+
+        if (rank == 0)
+        {
+            std::cout << "Entering Sobol sampler." << "\n\tnumber of points to calculate:  " << num << std::endl;
+        }
+
+        unsigned long long k = rank + done*numtasks;
+        bool quit = false;
+        while (k < num and not quit)
+        {
+            const size_t n = std::min(batch, (num - k + numtasks - 1)/numtasks);
+            for (size_t i = 0; i < n; i++)
+            {
+                sobol.point(first + k + i*numtasks, points[i]);
+                for (int d = 0; d < dim; d++) unit[d*n + i] = points[i][d];
+            }
+            LogLike.transform_batch(unit.data(), physical.data(), n);
+
+            for (size_t i = 0; i < n; i++, k += numtasks)
+            {
+                LogLike.evaluate_transformed(points[i].data(), &physical[i], n);
+                done++;
+
+                if (rank == 0 and done%1000 == 0)
+                    std::cout << "points:  " << k + 1 << " / " << num << std::endl;
+
+                if (Gambit::Scanner::Plugins::plugin_info.early_shutdown_in_progress())
+                {
+                    std::cout << "Rank " << rank << ": Sobol sampler received quit signal after " << done << " points. Writing resume data." << std::endl;
+                    set_resume_params.dump();
+                    quit = true;
+                    break;
+                }
+            }
+        }
+
+        return 0;
+    }
+}
@@ -28,28 +28,25 @@
 #include <sstream>
 
 #include "gambit/ScannerBit/scanner_plugin.hpp"
+#include "gambit/ScannerBit/task_dispatcher.hpp"
 
 scanner_plugin(square_grid, version(1, 0, 0))
 {
     int plugin_main()
     {
-        int rank, numtasks;
         int N = std::abs(get_inifile_value<int>("grid_pts", 2));
         if (N == 0) N = 1;
         int ma = get_dimension();
         
-#ifdef WITH_MPI
-        MPI_Comm_size(MPI_COMM_WORLD, &numtasks);
-        MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-#else
-        numtasks = 1;
-        rank = 0;
-#endif
-        
         like_ptr LogLike = get_purpose(get_inifile_value<std::string>("like"));
         std::vector<double> vec(ma, 0.0);
 
-        for (int i = rank, end = std::pow(N, ma); i < end; i+=numtasks)
+        bool dynamic = get_inifile_value<bool>("dynamic_dispatch", false);
+        if (dynamic) LogLike->disable_external_shutdown();
+        Gambit::Scanner::task_dispatcher tasks(std::pow(N, ma), dynamic, get_inifile_value<unsigned long long>("batch_size", 1));
+
+        unsigned long long i;
+        while (tasks.next(i))
         {
             int n = i;
             for (int j = 0; j < ma; j++)
@@ -63,6 +60,9 @@ scanner_plugin(square_grid, version(1, 0, 0))
             }
 
             LogLike(vec);
+
+            if (dynamic and Gambit::Scanner::Plugins::plugin_info.early_shutdown_in_progress())
+                tasks.quit();
         }
 
         return 0;
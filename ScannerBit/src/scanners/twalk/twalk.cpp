@@ -16,6 +16,9 @@
 ///          (p.scott@imperial.ac.uk)
 ///  \date 2018 June
 ///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
 ///  *********************************************
 
 #ifdef WITH_MPI
@@ -53,6 +56,33 @@ scanner_plugin(twalk, version(1, 0, 1))
         set_resume_params.set_resume_mode(get_printer().resume_mode());
 
         int pdim = get_inifile_value<int>("projection_dimension", 4);
+        int nchains = get_inifile_value<int>("chain_number", 1 + pdim + numtasks);
+
+        #ifdef WITH_MPI
+            if (get_inifile_value<bool>("async", false) and numtasks > 1)
+            {
+                // Every process holds the same number of chains, and needs at least four of them.
+                nchains = std::max(4*numtasks, (nchains + numtasks - 1)/numtasks*numtasks);
+                TWalkAsync(LogLike, get_printer(),
+                           set_resume_params,
+                           dim,
+                           get_inifile_value<double>("kwalk_ratio", 0.9836),
+                           pdim,
+                           get_inifile_value<double>("gaussian_distance", 2.4),
+                           get_inifile_value<double>("walk_distance", 2.5),
+                           get_inifile_value<double>("traverse_distance", 6.0),
+                           get_inifile_value<double>("sqrtR", 1.001),
+                           nchains,
+                           get_inifile_value<bool>("hyper_grid", true),
+                           get_inifile_value<int>("burn_in", 0),
+                           get_inifile_value<int>("save_freq", 1000),
+                           get_inifile_value<double>("timeout_mins", -1),
+                           std::max(1, get_inifile_value<int>("sync_interval", 100))
+                          );
+                return 0;
+            }
+        #endif
+
         TWalk(LogLike, get_printer(),
                         set_resume_params,
                         dim,
@@ -63,7 +93,7 @@ scanner_plugin(twalk, version(1, 0, 1))
                         get_inifile_value<double>("traverse_distance", 6.0),
                         get_inifile_value<long long>("ran_seed", 0),
                         get_inifile_value<double>("sqrtR", 1.001),
-                        get_inifile_value<int>("chain_number", 1 + pdim + numtasks),
+                        nchains,
                         get_inifile_value<bool>("hyper_grid", true),
                         get_inifile_value<int>("burn_in", 0),
                         get_inifile_value<int>("save_freq", 1000),
@@ -440,6 +470,344 @@ namespace Gambit
             return;
         }
 
+    #ifdef WITH_MPI
+        void TWalkAsync(Gambit::Scanner::like_ptr LogLike,
+                        Gambit::Scanner::printer_interface &printer,
+                        Gambit::Scanner::resume_params_func set_resume_params,
+                        const int &dimension,
+                        const double &div,
+                        const int &proj,
+                        const double &din,
+                        const double &alim,
+                        const double &alimt,
+                        const double &sqrtR,
+                        const int &NChains,
+                        const bool &hyper_grid,
+                        const int &burn_in,
+                        const int &save_freq,
+                        const double &mins_max,
+                        const int &sync_interval)
+        {
+            const double massiveR = 1e100;
+            const int rank = set_resume_params.Rank();
+            const int numtasks = set_resume_params.NumTasks();
+            // Chains held by this process, and the number of them handed on to another process after each epoch
+            const int nlocal = NChains/numtasks;
+            const int nswap = std::min(nlocal/2, nlocal - 3);
+            // Doubles needed to send one chain: position, running mean and sum of squared deviations,
+            // chisq, mult, count, rank, chain number and number of points in the running mean.
+            const int width = 3*dimension + 6;
+
+            std::vector<std::vector<double>> a0(nlocal, std::vector<double>(dimension));
+            std::vector<double> chisq(nlocal);
+            std::vector<int> mult(nlocal, 1);
+            std::vector<int> count(nlocal, 1);
+            std::vector<int> ranks(nlocal, rank);
+            std::vector<int> chain(nlocal);
+            std::vector<int> nstat(nlocal, 0);
+            std::vector<unsigned long long int> ids(nlocal);
+            std::vector<std::vector<double>> avgT(nlocal, std::vector<double>(dimension, 0.0));
+            std::vector<std::vector<double>> M2(nlocal, std::vector<double>(dimension, 0.0));
+            long long steps = 0;
+            int epoch = 0;
+            bool resumed = false;
+
+            set_resume_params(chisq, a0, mult, count, ranks, chain, nstat, ids, avgT, M2, steps, epoch, resumed);
+
+            Gambit::Scanner::assign_aux_numbers("mult", "chain");
+
+            std::chrono::time_point<std::chrono::system_clock> startTWalk = std::chrono::system_clock::now();
+
+            std::vector<RanNumGen *> gDev;
+            for (int i = 0; i < nlocal; i++)
+            {
+                gDev.push_back(new RanNumGen(proj, dimension, din, alim, alimt, div));
+            }
+
+            std::ofstream temp_file_out;
+            str filename = set_resume_params.get_temp_file_name("temp");
+            temp_file_out.open(filename, std::ofstream::binary | std::ofstream::app);
+            if (not temp_file_out.is_open()) scan_error().raise(LOCAL_INFO, "Problem opening temp file " + filename + " in TWalk!");
+
+            if (not resumed)
+            {
+                // Each process starts its own chains.
+                int quit = 0;
+                for (int t = 0; t < nlocal and not quit; t++)
+                {
+                    for (int j = 0; j < dimension; j++)
+                        a0[t][j] = gDev[t]->Doub();
+                    chisq[t] = -LogLike(a0[t]);
+                    ids[t] = LogLike->getPtID();
+                    chain[t] = rank*nlocal + t;
+                    quit = Gambit::Scanner::Plugins::plugin_info.early_shutdown_in_progress();
+                }
+                MPI_Allreduce(MPI_IN_PLACE, &quit, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+                if (quit)
+                {
+                    std::cout << "Rank " << rank << ": Quit signal received during TWalk chain initialisation, aborting run" << std::endl;
+                    for (auto &&gd : gDev) delete gd;
+                    temp_file_out.close();
+                    return;
+                }
+                resumed = true;
+            }
+
+            if (rank == 0)
+            {
+                std::cout << "Asynchronous TWalk Algorithm Started with " << nlocal*numtasks << " chains (" << nlocal
+                          << " per process, " << nswap << " handed on every " << sync_interval << " steps)" << std::endl;
+            }
+
+            auto pack = [&](int t, double *buf)
+            {
+                std::copy(a0[t].begin(), a0[t].end(), buf);
+                std::copy(avgT[t].begin(), avgT[t].end(), buf + dimension);
+                std::copy(M2[t].begin(), M2[t].end(), buf + 2*dimension);
+                buf += 3*dimension;
+                buf[0] = chisq[t];
+                buf[1] = mult[t];
+                buf[2] = count[t];
+                buf[3] = ranks[t];
+                buf[4] = chain[t];
+                buf[5] = nstat[t];
+            };
+
+            auto unpack = [&](int t, const double *buf)
+            {
+                std::copy(buf, buf + dimension, a0[t].begin());
+                std::copy(buf + dimension, buf + 2*dimension, avgT[t].begin());
+                std::copy(buf + 2*dimension, buf + 3*dimension, M2[t].begin());
+                buf += 3*dimension;
+                chisq[t] = buf[0];
+                mult[t] = buf[1];
+                count[t] = buf[2];
+                ranks[t] = buf[3];
+                chain[t] = buf[4];
+                nstat[t] = buf[5];
+            };
+
+            // Chains are handed over on a private communicator, so that they cannot be confused with other messages.
+            MPI_Comm comm;
+            MPI_Comm_dup(MPI_COMM_WORLD, &comm);
+            std::vector<MPI_Request> exchange(4, MPI_REQUEST_NULL);
+            std::vector<double> send_buf(nswap*width), recv_buf(nswap*width);
+            std::vector<unsigned long long int> send_ids(nswap), recv_ids(nswap);
+            std::vector<int> away;
+            std::vector<int> present(nlocal, 1);
+
+            // Summed over all processes: for each dimension, the chain means, their squares and the chain
+            // variances; then the number of chains in these sums, accepted points, steps, quit and timeout flags.
+            MPI_Request reduce = MPI_REQUEST_NULL;
+            std::vector<double> local_sums(3*dimension + 5), sums(3*dimension + 5);
+            bool reduce_pending = false;
+
+            const int dump_epochs = std::max(1, save_freq/sync_interval);
+            std::vector<double> aNext(dimension);
+            std::vector<int> tints;
+            tints.reserve(nlocal);
+            int stop = 0;
+
+            while (true)
+            {
+                // Take in the chains handed over at the end of the last epoch.
+                if (not away.empty())
+                {
+                    MPI_Waitall(exchange.size(), exchange.data(), MPI_STATUSES_IGNORE);
+                    for (int i = 0; i < nswap; i++)
+                    {
+                        unpack(away[i], &recv_buf[i*width]);
+                        ids[away[i]] = recv_ids[i];
+                        present[away[i]] = 1;
+                    }
+                    away.clear();
+                }
+
+                // Check the sums started at the end of the last epoch for convergence and stop signals.
+                if (reduce_pending)
+                {
+                    MPI_Wait(&reduce, MPI_STATUS_IGNORE);
+                    reduce_pending = false;
+
+                    const double Nc = sums[3*dimension];
+                    double Rsum = 0.0, Rmax = 0.0;
+                    bool converged = (Nc == nlocal*numtasks);
+                    for (int j = 0; j < dimension; j++)
+                    {
+                        double R = massiveR;
+                        if (Nc > 1)
+                        {
+                            double Bn = std::max(0.0, (sums[dimension + j] - sums[j]*sums[j]/Nc)/(Nc - 1.0));
+                            double W = sums[2*dimension + j]/Nc;
+                            if (W > 0.0) R = 1.0 + (Nc + 1.0)*Bn/(W*Nc);
+                        }
+                        Rsum += R;
+                        Rmax = std::max(Rmax, R);
+                        if (R >= sqrtR*sqrtR) converged = false;
+                    }
+
+                    if (sums[3*dimension + 3] > 0) stop = 1;
+                    else if (converged) stop = 2;
+                    else if (sums[3*dimension + 4] > 0) stop = 3;
+
+                    if (rank == 0)
+                    {
+                        const double cnt = sums[3*dimension + 1];
+                        std::cout << "Points = " << cnt  << " (" << cnt/double(nlocal*numtasks) << " per chain)" << std::endl;
+                        std::cout << "\tAcceptance ratio = " << cnt/sums[3*dimension + 2] << std::endl;
+                        std::cout << "\tsqrt(R) (averaged over all dimensions) = " << sqrt(Rsum/dimension) << std::endl;
+                        std::cout << "\tsqrt(R) (largest in any dimension) =     " << sqrt(Rmax) << std::endl;
+                        if (stop == 3) std::cout << "TWalk reached requested time limit of " << mins_max << " minutes.  Finalising run now." << std::endl;
+                    }
+                }
+
+                if (stop) break;
+
+                // Every chain is back in place and nothing is in flight, so the state is complete.
+                if (epoch > 0 and epoch%dump_epochs == 0) set_resume_params.dump();
+
+                std::fill(local_sums.begin(), local_sums.end(), 0.0);
+                for (int t = 0; t < nlocal; t++)
+                {
+                    if (nstat[t] > 1)
+                    {
+                        for (int j = 0; j < dimension; j++)
+                        {
+                            local_sums[j] += avgT[t][j];
+                            local_sums[dimension + j] += avgT[t][j]*avgT[t][j];
+                            local_sums[2*dimension + j] += M2[t][j]/(nstat[t] - 1.0);
+                        }
+                        local_sums[3*dimension] += 1.0;
+                    }
+                    local_sums[3*dimension + 1] += count[t];
+                }
+                local_sums[3*dimension + 2] = steps;
+                local_sums[3*dimension + 3] = Gambit::Scanner::Plugins::plugin_info.early_shutdown_in_progress();
+                if (rank == 0 and mins_max > 0)
+                {
+                    std::chrono::duration<double> runtime = std::chrono::system_clock::now() - startTWalk;
+                    local_sums[3*dimension + 4] = (runtime.count()/60.0 >= mins_max);
+                }
+                MPI_Iallreduce(local_sums.data(), sums.data(), sums.size(), MPI_DOUBLE, MPI_SUM, comm, &reduce);
+                reduce_pending = true;
+
+                // Hand a random choice of chains on to the next process along (a different one each epoch),
+                // and get the same number back from the previous one.  They arrive by the end of the next epoch.
+                const int shift = 1 + epoch%(numtasks - 1);
+                const int dest = (rank + shift)%numtasks;
+                const int source = (rank - shift + numtasks)%numtasks;
+                tints.resize(nlocal);
+                for (int t = 0; t < nlocal; t++) tints[t] = t;
+                for (int i = 0; i < nswap; i++)
+                {
+                    int k = i + int((nlocal - i)*gDev[0]->Doub());
+                    std::swap(tints[i], tints[k]);
+                    pack(tints[i], &send_buf[i*width]);
+                    send_ids[i] = ids[tints[i]];
+                    present[tints[i]] = 0;
+                    away.push_back(tints[i]);
+                }
+                MPI_Irecv(recv_buf.data(), recv_buf.size(), MPI_DOUBLE, source, 0, comm, &exchange[0]);
+                MPI_Irecv(recv_ids.data(), recv_ids.size(), MPI_UNSIGNED_LONG_LONG, source, 1, comm, &exchange[1]);
+                MPI_Isend(send_buf.data(), send_buf.size(), MPI_DOUBLE, dest, 0, comm, &exchange[2]);
+                MPI_Isend(send_ids.data(), send_ids.size(), MPI_UNSIGNED_LONG_LONG, dest, 1, comm, &exchange[3]);
+                epoch++;
+
+                // Move the chains that stayed here, without waiting for any other process.
+                for (int n = 0; n < sync_interval; n++)
+                {
+                    tints.clear();
+                    for (int t = 0; t < nlocal; t++) if (present[t]) tints.push_back(t);
+                    int k = int(tints.size()*gDev[0]->Doub());
+                    const int t = tints[k];
+                    tints[k] = tints.back();
+                    tints.pop_back();
+                    const int tt = tints[int(tints.size()*gDev[0]->Doub())];
+                    double logZ = gDev[t]->Dev(aNext, a0, t, tt, tints.size(), tints);
+
+                    if(!(hyper_grid && notUnit(aNext)))
+                    {
+                        double chisqnext = -LogLike(aNext);
+                        double ans = chisqnext - chisq[t] - logZ;
+                        unsigned long long int next_id = LogLike->getPtID();
+                        if ((ans <= 0.0)||(gDev[0]->ExpDev() >= ans))
+                        {
+                            point_info info = {mult[t], chain[t], ranks[t], ids[t]};
+                            temp_file_out.write((char *)&info, sizeof(point_info));
+
+                            ids[t] = next_id;
+                            a0[t] = aNext;
+                            chisq[t] = chisqnext;
+                            ranks[t] = rank;
+                            mult[t] = 0;
+                            count[t]++;
+                        }
+                        else
+                        {
+                            point_info info = {0, -1, rank, next_id};
+                            temp_file_out.write((char *)&info, sizeof(point_info));
+                        }
+                    }
+
+                    for (int l = 0; l < nlocal; l++) if (present[l]) mult[l]++;
+                    steps++;
+
+                    // Update the running mean and variance of each chain here (Welford's method).
+                    if (steps%nlocal == 0)
+                    {
+                        for (int l = 0; l < nlocal; l++) if (present[l] and count[l] >= burn_in)
+                        {
+                            nstat[l]++;
+                            for (int j = 0; j < dimension; j++)
+                            {
+                                double delta = a0[l][j] - avgT[l][j];
+                                avgT[l][j] += delta/nstat[l];
+                                M2[l][j] += delta*(a0[l][j] - avgT[l][j]);
+                            }
+                        }
+                    }
+                }
+            }
+
+            MPI_Comm_free(&comm);
+
+            if (stop == 1)
+            {
+                std::cout << "Rank " << rank << ": TWalk received quit signal! Writing resume data." << std::endl;
+                set_resume_params.dump();
+            }
+            else
+            {
+                // The run is complete, so the current points of the chains get their final weights.
+                for (int t = 0; t < nlocal; t++)
+                {
+                    point_info info = {mult[t], chain[t], ranks[t], ids[t]};
+                    temp_file_out.write((char *)&info, sizeof(point_info));
+                }
+            }
+
+            for (auto &&gd : gDev) delete gd;
+
+            temp_file_out.close();
+            Gambit::Scanner::printer *out_stream = printer.get_stream("txt");
+            std::ifstream temp_file_in(filename.c_str(), std::ifstream::binary);
+            point_info info;
+            while (temp_file_in.read((char *)&info, sizeof(point_info)))
+            {
+                out_stream->print(info.mult, "mult", info.rank, info.id);
+                out_stream->print(info.chain, "chain", info.rank, info.id);
+            }
+            out_stream->flush();
+            temp_file_in.close();
+
+            // Start the temporary file afresh, so that these points are not printed again if the run is resumed.
+            temp_file_out.open(filename, std::ofstream::binary | std::ofstream::trunc);
+            temp_file_out.close();
+
+            std::cout << "TWalk has finished in process " << rank << "." << std::endl;
+        }
+    #endif
+
     }
 
 }
@@ -24,6 +24,7 @@
 #include <set>
 #include <string>
 #include <exception>
+#include <functional>
 #include <vector>
 #include <utility>
 
@@ -92,6 +93,9 @@ namespace Gambit
       /// Set the parameter point string to append if a fatal exception is thrown
       static void set_parameters(std::string);
 
+      /// Set a function that gives the parameter point string, only called if a fatal exception is thrown
+      static void set_parameters(std::function<std::string()>);
+
     protected:
 
       /// The set of tags to be passed to the logger
@@ -108,6 +112,9 @@ namespace Gambit
       /// Throw the exception onward if running serially, abort if not.
       void throw_iff_outside_parallel();
 
+      /// Get the parameter point string, from parameter_source if set
+      static std::string current_parameters();
+
       /// Cause the code to print the exception and abort.
       void abort_here_and_now();
 
@@ -129,6 +136,9 @@ namespace Gambit
       /// Shared string indicating the current values of the paramters.
       static std::string parameters;
 
+      /// Shared function giving the current values of the parameters (replaces parameters if set).
+      static std::function<std::string()> parameter_source;
+
   };
 
 
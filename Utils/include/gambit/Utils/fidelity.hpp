@@ -0,0 +1,52 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Fidelity level of the current point, for
+///  module functions that can trade accuracy for
+///  speed.  Level 0 is the cheapest, and
+///  fidelity_levels()-1 is full accuracy (the
+///  only level unless multi-fidelity evaluation
+///  is switched on).
+///
+///  Most functors need not look at the level:
+///  their options can be set per level in the
+///  YAML file instead, with a 'fidelity' list of
+///  option overrides, lowest level first.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#ifndef __fidelity_hpp__
+#define __fidelity_hpp__
+
+namespace Gambit
+{
+   namespace Utils
+   {
+
+      /// Number of fidelity levels at which points can be computed
+      int fidelity_levels();
+
+      /// Fidelity level at which the current point is being computed
+      int fidelity_level();
+
+      /// Check whether the current point is being computed at full accuracy
+      inline bool full_fidelity() { return fidelity_level() == fidelity_levels() - 1; }
+
+      /// Set the number of levels (for the dependency resolver only)
+      void set_fidelity_levels(int levels);
+
+      /// Set the level of the current point (for the dependency resolver only)
+      void set_fidelity_level(int level);
+
+   }
+}
+
+#endif
@@ -43,6 +43,8 @@
 
 #include <map>
 #include <vector>
+#include <string>
+#include <utility>
 #include <iostream>
 #include "gambit/Utils/export_symbols.hpp"
 
@@ -61,6 +63,32 @@ namespace Gambit {
 
     public:
 
+      /// Iterator over (name, value) pairs of the parameters, in alphabetical order of name
+      class const_iterator
+      {
+        public:
+          typedef std::pair<const std::string&, const double&> value_type;
+
+          /// Holder allowing it->first and it->second
+          struct pointer
+          {
+            value_type pair;
+            const value_type* operator->() const { return &pair; }
+          };
+
+          const_iterator(std::map<std::string,size_t>::const_iterator it, const double* values) : it(it), values(values) {}
+          value_type operator*() const { return value_type(it->first, values[it->second]); }
+          pointer operator->() const { return pointer{**this}; }
+          const_iterator& operator++() { ++it; return *this; }
+          const_iterator operator++(int) { const_iterator tmp(*this); ++it; return tmp; }
+          bool operator==(const const_iterator& other) const { return it == other.it; }
+          bool operator!=(const const_iterator& other) const { return it != other.it; }
+
+        private:
+          std::map<std::string,size_t>::const_iterator it;
+          const double* values;
+      };
+
       /// Default constructor
       ModelParameters();
 
@@ -69,21 +97,37 @@ namespace Gambit {
     
       /// Constructor using array of char arrays
       ModelParameters(const char**);
+
+      /// Copy constructor
+      ModelParameters(const ModelParameters&);
+
+      /// Copy assignment
+      ModelParameters& operator=(const ModelParameters&);
    
       /// Get value of named parameter 
       double getValue(std::string const & inkey) const;
 
+      /// Get value of parameter by index (see getIndex); no checks are made
+      const double& getValue(size_t index) const { return _values[index]; }
+
+      /// Get the index of a named parameter, for fast repeated access with getValue and setValue.
+      /// Indices follow the alphabetical order of the names, and are fixed once all parameters are defined.
+      size_t getIndex(std::string const & inkey) const;
+
       /// Check if a parameter exists in this object
       bool has(const std::string&) const;
 
       /// Get values of all parameters
       const std::map<std::string, double>& getValues() const;
-   
-      /// Get a const iterator to the first parameter map entry
-      std::map<std::string, double>::const_iterator begin() const;
 
-      /// Get a const iterator to the last parameter map entry
-      std::map<std::string, double>::const_iterator end() const;
+      /// Get the values of all parameters as a contiguous array, in order of index
+      const std::vector<double>& getValueArray() const { return _values; }
+
+      /// Get a const iterator to the first parameter
+      const_iterator begin() const;
+
+      /// Get a const iterator to one past the last parameter
+      const_iterator end() const;
 
       /// Get number of parameters stored in this object
       int getNumberOfPars() const;
@@ -96,6 +140,9 @@ namespace Gambit {
 
       /// Set single parameter value
       void setValue(std::string const &inkey,double const&value);
+
+      /// Set single parameter value by index (see getIndex); no checks are made
+      void setValue(size_t index, double value) { _values[index] = *_mapped[index] = value; }
   
       /// Set many parameter values using a map
       void setValues(std::map<std::string,double> const &params_map, bool missing_is_error = true);
@@ -113,7 +160,7 @@ namespace Gambit {
       friend std::ostream &operator<<(std::ostream &strm, const ModelParameters &me)
       {
         strm << "ModelParameters: Printing: "<<std::endl;
-        for (std::map<std::string,double>::const_iterator it=me._values.begin();it!=me._values.end();it++)
+        for (const_iterator it=me.begin();it!=me.end();it++)
         {
           strm << "parameter: " << it->first << " value: "<<it->second ;
         }
@@ -137,8 +184,20 @@ namespace Gambit {
  
     private:
 
-      /// Internal map representation of parameters and their values
-      std::map<std::string,double> _values;
+      /// Parameter values, stored contiguously in order of index
+      std::vector<double> _values;
+
+      /// Map of parameter names to their indices in _values
+      std::map<std::string,size_t> _indices;
+
+      /// Map of parameter names to their values, kept in step with _values for getValues
+      std::map<std::string,double> _valuemap;
+
+      /// Entries of _valuemap, in order of index
+      std::vector<double*> _mapped;
+
+      /// Point _mapped at the entries of _valuemap
+      void _relink();
 
       /// Name of the model; intended mainly for more helpful error messages
       std::string modelname;
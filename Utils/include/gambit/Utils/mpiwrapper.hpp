@@ -344,6 +344,33 @@ namespace Gambit
                Isend(buf, count, datatype, destination, tag, request);
             }
 
+            /// Non-blocking receive
+            void Irecv(void *buf /*out*/, int count, MPI_Datatype datatype,
+                                  int source, int tag,
+                                  MPI_Request *request /*out*/)
+            {
+              #ifdef MPI_MSG_DEBUG
+              std::cerr<<"rank "<<Get_rank()<<": Irecv() called (count="<<count<<", source="<<source<<", tag="<<tag<<")"<<std::endl;
+              #endif
+              int errflag;
+               errflag = MPI_Irecv(buf, count, datatype, source, tag, boundcomm, request);
+               if(errflag!=0) {
+                 std::ostringstream errmsg;
+                 errmsg << "Error performing MPI_Irecv! Received error flag: "<<errflag;
+                 utils_error().raise(LOCAL_INFO, errmsg.str());
+               }
+            }
+
+            /// Templated Non-blocking receive
+            template<class T>
+            void Irecv(T *buf /*out*/, int count,
+                      int source, int tag,
+                      MPI_Request *request /*out*/)
+            {
+               static const MPI_Datatype datatype = get_mpi_data_type<T>::type();
+               Irecv(buf, count, datatype, source, tag, request);
+            }
+
             /// Blocking wait for e.g. Isend to complete
             void Wait(MPI_Request *request)
             {
@@ -356,6 +383,20 @@ namespace Gambit
                }
             }
 
+            /// Non-blocking check for e.g. Isend to complete.  Returns true (and frees the request) if it has.
+            bool Test(MPI_Request *request)
+            {
+               int flag;
+               MPI_Status status;
+               int errflag = MPI_Test(request, &flag, &status);
+               if(errflag!=0) {
+                 std::ostringstream errmsg;
+                 errmsg << "Error performing MPI_Test! Received error flag: "<<errflag;
+                 utils_error().raise(LOCAL_INFO, errmsg.str());
+               }
+               return (flag != 0);
+            }
+
             // Non-blocking probe for messages waiting to be delivered
             bool Iprobe(int source, int tag, MPI_Status* in_status=NULL /*out*/)
             {
@@ -445,6 +486,22 @@ namespace Gambit
                 MPI_Allreduce (&sendbuf, &recvbuf, 1, datatype, op, boundcomm);
             }
 
+            /// Non-blocking element-wise reduction of a vector over all processes.  Every process must start the
+            /// same reductions in the same order, and neither buffer may be touched until Wait or Test says it is done.
+            template<typename T>
+            void Iallreduce (std::vector<T> &sendbuf, std::vector<T> &recvbuf, MPI_Op op, MPI_Request *request /*out*/)
+            {
+                static const MPI_Datatype datatype = get_mpi_data_type<T>::type();
+
+                recvbuf.resize(sendbuf.size());
+                int errflag = MPI_Iallreduce (sendbuf.data(), recvbuf.data(), sendbuf.size(), datatype, op, boundcomm, request);
+                if(errflag!=0) {
+                  std::ostringstream errmsg;
+                  errmsg << "Error performing MPI_Iallreduce! Received error flag: "<<errflag;
+                  utils_error().raise(LOCAL_INFO, errmsg.str());
+                }
+            }
+
             template<typename T>
             void Gather(std::vector<T> &sendbuf, std::vector<T> &recvbuf, int root)
             {
@@ -0,0 +1,162 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Lightweight profiler for recording where
+///  the time goes within likelihood evaluations
+///  (module functions, backend calls, printer
+///  flushes).
+///
+///  Only a fraction of points is recorded; when
+///  a point is not being recorded, each hook
+///  costs a single flag check. The events of each
+///  recorded point are appended to a Chrome
+///  trace-event file (load in chrome://tracing or
+///  Perfetto) as soon as the point is finished,
+///  and at the end of the run (or on early
+///  shutdown) each process also writes a
+///  collapsed-stack file (for flamegraph.pl or
+///  speedscope).
+///
+///  Usage:
+///
+///   {
+///     Utils::profile_scope scope("backend", "DarkSUSY", "dsddgpgp");
+///     /* Work to be timed */
+///   }
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#ifndef __profiler_hpp__
+#define __profiler_hpp__
+
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <chrono>
+#include <fstream>
+
+namespace Gambit
+{
+   namespace Utils
+   {
+
+      /// Records timed, nested events from any number of threads, for a sample of points.
+      class Profiler
+      {
+        public:
+          /// Write out whatever has not been written yet, e.g. after an exception.
+          ~Profiler() { finalise(); }
+
+          /// Set up the profiler.  A fraction sample_fraction of points will be recorded.
+          void configure(double sample_fraction, int rank, const std::string& output_prefix);
+
+          /// Start a new point, and decide whether it will be recorded.
+          void begin_point();
+
+          /// Finish the current point, and append its events to the trace-event file.
+          void end_point();
+
+          /// Check whether the current point is being recorded.  Safe to call from any thread.
+          bool active() const { return recording.load(std::memory_order_relaxed); }
+
+          /// Open an event called origin::name on the calling thread.  Events must be closed in reverse order of opening.
+          void begin_event(const char* category, const std::string& origin, const std::string& name);
+
+          /// Close the most recently opened event on the calling thread.
+          void end_event();
+
+          /// Close the trace-event file and write the collapsed-stack file.  Only the first call does anything.
+          void finalise();
+
+        private:
+          typedef std::chrono::steady_clock clock;
+
+          /// An event that has been opened but not yet closed
+          struct open_event
+          {
+            const char* category;
+            std::string name;
+            double start;
+            double child_time;
+          };
+
+          /// An event that has been closed
+          struct closed_event
+          {
+            const char* category;
+            std::string name;
+            double start;
+            double duration;
+          };
+
+          /// Events recorded by a single thread
+          struct thread_buffer
+          {
+            int thread_id;
+            std::vector<open_event> stack;
+            std::vector<closed_event> events;
+            /// Time spent in each stack of events, excluding time spent in events further up the stack [us]
+            std::map<std::string, double> self_times;
+          };
+
+          /// Get the buffer of the calling thread, creating it if needed
+          thread_buffer& my_buffer();
+
+          /// Time since the profiler was configured [us]
+          double now() const;
+
+          /// Append the closed events of all threads to the trace-event file, and free them.  Needs buffers_mutex.
+          void flush_events();
+
+          bool enabled = false;
+          bool finalised = false;
+          std::atomic<bool> recording{false};
+          double sample_fraction = 0;
+          unsigned long long npoints = 0;
+          int rank = 0;
+          std::string output_prefix;
+          clock::time_point t0;
+          std::ofstream trace;
+          bool first_event = true;
+
+          std::mutex buffers_mutex;
+          std::vector<std::unique_ptr<thread_buffer>> buffers;
+      };
+
+      /// Global profiler instance
+      Profiler& profiler();
+
+      /// Scope guard that records an event for the lifetime of the object, if the current point is being recorded
+      class profile_scope
+      {
+        public:
+          profile_scope(const char* category, const std::string& origin, const std::string& name) : live(profiler().active())
+          {
+            if (live) profiler().begin_event(category, origin, name);
+          }
+          ~profile_scope()
+          {
+            if (live) profiler().end_event();
+          }
+          profile_scope(const profile_scope&) = delete;
+          profile_scope& operator=(const profile_scope&) = delete;
+
+        private:
+          const bool live;
+      };
+
+   }
+}
+
+#endif
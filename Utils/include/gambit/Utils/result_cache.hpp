@@ -0,0 +1,261 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Persistent on-disk cache of functor results,
+///  shared between processes and runs.
+///
+///  Each entry lives in its own file, named after
+///  a hash of its key.  Entries are written to a
+///  temporary file and then renamed into place,
+///  so that processes reading the cache (possibly
+///  on other nodes of a shared filesystem) never
+///  see a partial entry.  The full key is stored
+///  in the entry and checked on lookup, so hash
+///  collisions cannot return the wrong result.
+///
+///  The total size of the entries is kept in a
+///  file in the cache directory, which is locked
+///  while an entry is added.  If an entry would
+///  take the cache beyond its size limit, the
+///  least recently used entries are removed
+///  first, so the limit holds however many
+///  processes share the cache.
+///
+///  Results are converted to and from bytes by
+///  cache_serialiser<TYPE>, which supports
+///  arithmetic types, strings, and std::vector,
+///  std::pair and std::map of supported types.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#ifndef __result_cache_hpp__
+#define __result_cache_hpp__
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <ctime>
+#include <istream>
+#include <ostream>
+#include <type_traits>
+
+namespace Gambit
+{
+   namespace Utils
+   {
+
+      /// 64-bit FNV-1a hash of a string.  Unlike std::hash, this is the same for every build and platform.
+      std::uint64_t fnv1a_hash(const std::string& s, std::uint64_t h = 14695981039346656037ULL);
+
+      /// Conversion of functor results to and from bytes, for types that cannot be cached
+      template <typename T, typename Enable = void>
+      struct cache_serialiser
+      {
+        static const bool supported = false;
+        static void write(std::ostream&, const T&) {}
+        static bool read(std::istream&, T&) { return false; }
+      };
+
+      /// Conversion of arithmetic types to and from bytes
+      template <typename T>
+      struct cache_serialiser<T, typename std::enable_if<std::is_arithmetic<T>::value>::type>
+      {
+        static const bool supported = true;
+        static void write(std::ostream& out, const T& x) { out.write(reinterpret_cast<const char*>(&x), sizeof(T)); }
+        static bool read(std::istream& in, T& x) { return bool(in.read(reinterpret_cast<char*>(&x), sizeof(T))); }
+      };
+
+      /// Conversion of strings to and from bytes
+      template <>
+      struct cache_serialiser<std::string>
+      {
+        static const bool supported = true;
+        static void write(std::ostream& out, const std::string& s)
+        {
+          cache_serialiser<std::uint64_t>::write(out, s.size());
+          out.write(s.data(), s.size());
+        }
+        static bool read(std::istream& in, std::string& s)
+        {
+          std::uint64_t n;
+          if (not cache_serialiser<std::uint64_t>::read(in, n)) return false;
+          s.resize(n);
+          return n == 0 or bool(in.read(&s[0], n));
+        }
+      };
+
+      /// Conversion of vectors to and from bytes
+      template <typename T>
+      struct cache_serialiser<std::vector<T>>
+      {
+        static const bool supported = cache_serialiser<T>::supported;
+        static void write(std::ostream& out, const std::vector<T>& v)
+        {
+          cache_serialiser<std::uint64_t>::write(out, v.size());
+          for (std::size_t i = 0; i < v.size(); ++i) cache_serialiser<T>::write(out, v[i]);
+        }
+        static bool read(std::istream& in, std::vector<T>& v)
+        {
+          std::uint64_t n;
+          if (not cache_serialiser<std::uint64_t>::read(in, n)) return false;
+          v.clear();
+          v.reserve(n);
+          for (std::uint64_t i = 0; i < n; ++i)
+          {
+            T x;
+            if (not cache_serialiser<T>::read(in, x)) return false;
+            v.push_back(x);
+          }
+          return true;
+        }
+      };
+
+      /// Conversion of pairs to and from bytes
+      template <typename T1, typename T2>
+      struct cache_serialiser<std::pair<T1,T2>>
+      {
+        static const bool supported = cache_serialiser<T1>::supported and cache_serialiser<T2>::supported;
+        static void write(std::ostream& out, const std::pair<T1,T2>& p)
+        {
+          cache_serialiser<T1>::write(out, p.first);
+          cache_serialiser<T2>::write(out, p.second);
+        }
+        static bool read(std::istream& in, std::pair<T1,T2>& p)
+        {
+          return cache_serialiser<T1>::read(in, p.first) and cache_serialiser<T2>::read(in, p.second);
+        }
+      };
+
+      /// Conversion of maps to and from bytes
+      template <typename K, typename V, typename C>
+      struct cache_serialiser<std::map<K,V,C>>
+      {
+        static const bool supported = cache_serialiser<K>::supported and cache_serialiser<V>::supported;
+        static void write(std::ostream& out, const std::map<K,V,C>& m)
+        {
+          cache_serialiser<std::uint64_t>::write(out, m.size());
+          for (const auto& entry : m)
+          {
+            cache_serialiser<K>::write(out, entry.first);
+            cache_serialiser<V>::write(out, entry.second);
+          }
+        }
+        static bool read(std::istream& in, std::map<K,V,C>& m)
+        {
+          std::uint64_t n;
+          if (not cache_serialiser<std::uint64_t>::read(in, n)) return false;
+          m.clear();
+          for (std::uint64_t i = 0; i < n; ++i)
+          {
+            K k;
+            if (not cache_serialiser<K>::read(in, k) or not cache_serialiser<V>::read(in, m[k])) return false;
+          }
+          return true;
+        }
+      };
+
+      /// @{ Conversion of x to and from bytes, doing nothing (and so not requiring the serialiser to compile) if T is not supported
+      template <typename T>
+      void cache_write(std::ostream& out, const T& x, std::true_type) { cache_serialiser<T>::write(out, x); }
+      template <typename T>
+      void cache_write(std::ostream&, const T&, std::false_type) {}
+      template <typename T>
+      void cache_write(std::ostream& out, const T& x) { cache_write(out, x, std::integral_constant<bool, cache_serialiser<T>::supported>()); }
+
+      template <typename T>
+      bool cache_read(std::istream& in, T& x, std::true_type) { return cache_serialiser<T>::read(in, x); }
+      template <typename T>
+      bool cache_read(std::istream&, T&, std::false_type) { return false; }
+      template <typename T>
+      bool cache_read(std::istream& in, T& x) { return cache_read(in, x, std::integral_constant<bool, cache_serialiser<T>::supported>()); }
+      /// @}
+
+
+      /// Persistent key-value store for functor results, safe for use by many processes at once
+      class result_cache
+      {
+        public:
+          /// Use (and create if needed) the cache in directory path, keeping its total size below max_bytes
+          result_cache(const std::string& path, std::uint64_t max_bytes);
+
+          /// Destructor
+          ~result_cache();
+
+          /// Look up the entry for key.  Returns false if there is none.
+          bool load(const std::string& key, std::string& data);
+
+          /// Save data as the entry for key, replacing any existing entry
+          void store(const std::string& key, const std::string& data);
+
+          /// Getters for the lookup statistics of this process
+          /// @{
+          long long hits() const { return n_hits; }
+          long long misses() const { return n_misses; }
+          long long stores() const { return n_stores; }
+          /// @}
+
+          /// Getter for the cache directory
+          const std::string& path() const { return dir; }
+
+        private:
+          /// An entry found while scanning the cache
+          struct cache_entry
+          {
+            std::string name;
+            std::uint64_t size;
+            time_t mtime;
+          };
+
+          /// Location of the entry for key
+          std::string entry_path(const std::string& key) const;
+
+          /// Take (true) or release (false) the lock on the size file, waiting for other processes to release it
+          bool lock_size_file(bool take);
+
+          /// Read and write the total size of the entries in the size file
+          /// @{
+          bool read_size(std::uint64_t& total);
+          void write_size(std::uint64_t total);
+          /// @}
+
+          /// Add up the sizes of all entries, optionally listing them, and remove stale temporary files
+          std::uint64_t scan(std::vector<cache_entry>* entries);
+
+          /// Remove the least recently used entries until the cache, plus an entry of size incoming, is comfortably below its size limit.
+          /// Must be called with the size file locked.  Returns the total size of the remaining entries.
+          std::uint64_t evict(std::uint64_t incoming);
+
+          /// Cache directory (ending in a slash) and size limit
+          const std::string dir;
+          const std::uint64_t max_bytes;
+
+          /// Descriptor of the size file, kept open while the cache is in use (-1 if it could not be opened)
+          int size_fd;
+
+          /// Lookup statistics for this process
+          long long n_hits, n_misses, n_stores;
+
+          /// Unique suffix for the temporary files of this process
+          std::string tmp_suffix;
+
+          /// Protects the statistics from concurrent functor evaluations
+          std::mutex mtx;
+
+          /// Excludes other threads of this process while the size file is locked
+          std::mutex size_mtx;
+      };
+
+   }
+}
+
+#endif
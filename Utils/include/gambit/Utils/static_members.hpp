@@ -29,6 +29,7 @@ namespace Gambit
 
   /// Shared string indicating the current values of the paramters.
   str exception::parameters = "";
+  std::function<str()> exception::parameter_source = nullptr;
 
 }
 
@@ -0,0 +1,61 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Declarations of analytic test functions for
+///  optimisation and sampling, shared by the
+///  ObjectivesBit module functions and the
+///  benchmark objective plugins of ScannerBit.
+///
+///  All are written as log-likelihoods, i.e. to
+///  be maximised.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#ifndef __test_functions_hpp__
+#define __test_functions_hpp__
+
+#include <vector>
+
+#include "gambit/Utils/export_symbols.hpp"
+
+namespace Gambit
+{
+
+  namespace TestFunctions
+  {
+
+    /// Minus the Rosenbrock function (https://en.wikipedia.org/wiki/Rosenbrock_function).  Maximum of 0 at (1, ..., 1).
+    EXPORT_SYMBOLS double rosenbrock(const std::vector<double>&);
+
+    /// Minus Himmelblau's function (https://en.wikipedia.org/wiki/Himmelblau%27s_function).  Four maxima of 0, one at (3, 2).
+    EXPORT_SYMBOLS double himmelblau(const std::vector<double>&);
+
+    /// Minus the Ackley function (https://en.wikipedia.org/wiki/Ackley_function).  Maximum of 0 at the origin.
+    EXPORT_SYMBOLS double ackley(const std::vector<double>&);
+
+    /// Test problem 2 of arXiv:1306.2144.  Maximum of 3^5 wherever the product of the cos(5 pi x_i) is 1.
+    EXPORT_SYMBOLS double eggbox(const std::vector<double>&);
+
+    /// Minus the Rastrigin function (https://en.wikipedia.org/wiki/Rastrigin_function).  Maximum of 0 at the origin.
+    EXPORT_SYMBOLS double rastrigin(const std::vector<double>&);
+
+    /// Minus the Beale function (https://en.wikipedia.org/wiki/Test_functions_for_optimization).  Maximum of 0 at (3, 0.5).
+    EXPORT_SYMBOLS double beale(const std::vector<double>&);
+
+    /// Test problem 1 of arXiv:1306.2144: two Gaussian shells of radius 2 and width 0.1, centred on (-3.5, ...) and
+    /// (3.5, ...).
+    EXPORT_SYMBOLS double shells(const std::vector<double>&);
+
+  }
+
+}
+
+#endif
@@ -239,6 +239,10 @@ namespace Gambit
       YAML::const_iterator begin() const { return options.begin(); }
       YAML::const_iterator end() const { return options.end(); }
 
+      /// Make this object refer to the options of another one.  Unlike assignment, this leaves the options that
+      /// it referred to before (and any other object sharing them) unchanged.
+      void rebind(const Options &other) { options.reset(other.options); }
+
     private:
 
       YAML::Node options;
@@ -62,6 +62,9 @@ namespace Gambit
         YAML::Node getLoggerNode() const;
         YAML::Node getKeyValuePairNode() const;
         
+        /// Getter for the default output path (set in the yaml file, or derived from its name)
+        str getDefaultOutputPath() const;
+
         template <typename... args>
         bool hasKey(args... keys) const
         {
@@ -118,6 +121,7 @@ namespace Gambit
         YAML::Node printerNode;
         YAML::Node scannerNode;
         YAML::Node logNode;
+        str defaultOutputPath;
     };
 
 
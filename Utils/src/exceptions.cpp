@@ -191,7 +191,7 @@ namespace Gambit
     /// This is the regular way to trigger a GAMBIT error or warning.
     void exception::raise(const std::string& origin, const std::string& specific_message)
     {
-      str full_message = isFatal ? specific_message+parameters : specific_message;
+      str full_message = isFatal ? specific_message+current_parameters() : specific_message;
       #pragma omp critical (GAMBIT_exception)
       {
         log_exception(origin, full_message);
@@ -204,7 +204,7 @@ namespace Gambit
     {
       #pragma omp critical (GAMBIT_exception)
       {
-        log_exception(origin, specific_message+parameters);
+        log_exception(origin, specific_message+current_parameters());
       }
       throw(*this);
     }
@@ -225,6 +225,13 @@ namespace Gambit
     void exception::set_parameters(str params)
     {
       parameters = params;
+      parameter_source = nullptr;
+    }
+
+    /// Set a function that gives the parameter point string, only called if a fatal exception is thrown
+    void exception::set_parameters(std::function<str()> source)
+    {
+      parameter_source = source;
     }
 
   // Private members of GAMBIT exception base class.
@@ -259,6 +266,12 @@ namespace Gambit
       logger() << msg.str() << EOM;
     }
 
+    /// Get the parameter point string, from parameter_source if set
+    str exception::current_parameters()
+    {
+      return parameter_source ? parameter_source() : parameters;
+    }
+
     /// Throw the exception onward if running serially, abort if not.
     void exception::throw_iff_outside_parallel()
     {
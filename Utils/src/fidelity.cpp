@@ -0,0 +1,42 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Fidelity level of the current point.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#include "gambit/Utils/fidelity.hpp"
+
+namespace Gambit
+{
+   namespace Utils
+   {
+
+      namespace
+      {
+         int n_levels = 1;
+         int current_level = 0;
+      }
+
+      int fidelity_levels() { return n_levels; }
+
+      int fidelity_level() { return current_level; }
+
+      void set_fidelity_levels(int levels)
+      {
+         n_levels = levels;
+         current_level = levels - 1;
+      }
+
+      void set_fidelity_level(int level) { current_level = level; }
+
+   }
+}
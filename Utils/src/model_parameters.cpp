@@ -27,6 +27,7 @@
 
 
 #include <map>
+#include <iterator>
 #include <iostream>
 #include <sstream>
 
@@ -54,48 +55,82 @@ namespace Gambit
    /// Check if a parameter exists in this object
    bool ModelParameters::has(const std::string& inkey) const
    {
-      return (_values.count(inkey)!=0);
+      return (_indices.count(inkey)!=0);
    }
 
 
    /// Default constructor
-   ModelParameters::ModelParameters(): _values(), modelname("None"), outputname("None") {}
+   ModelParameters::ModelParameters(): _values(), _indices(), _valuemap(), _mapped(), modelname("None"), outputname("None") {}
 
    /// Constructor using vector of strings
-   ModelParameters::ModelParameters(const std::vector<std::string> &paramlist): _values(), modelname("None"), outputname("None") 
+   ModelParameters::ModelParameters(const std::vector<std::string> &paramlist): _values(), _indices(), _valuemap(), _mapped(), modelname("None"), outputname("None") 
    {
      _definePars(paramlist);
    }
    
    /// Constructor using array of char arrays
-   ModelParameters::ModelParameters(const char** paramlist): _values(), modelname("None"), outputname("None") 
+   ModelParameters::ModelParameters(const char** paramlist): _values(), _indices(), _valuemap(), _mapped(), modelname("None"), outputname("None") 
    {
      _definePars(paramlist);
    }
+
+   /// Copy constructor
+   ModelParameters::ModelParameters(const ModelParameters& other)
+    : _values(other._values), _indices(other._indices), _valuemap(other._valuemap), _mapped()
+    , modelname(other.modelname), outputname(other.outputname)
+   {
+     _relink();
+   }
+
+   /// Copy assignment
+   ModelParameters& ModelParameters::operator=(const ModelParameters& other)
+   {
+     if (this == &other) return *this;
+     _values = other._values;
+     _indices = other._indices;
+     _valuemap = other._valuemap;
+     modelname = other.modelname;
+     outputname = other.outputname;
+     _relink();
+     return *this;
+   }
+
+   /// Point _mapped at the entries of _valuemap; both follow the alphabetical order of the names
+   void ModelParameters::_relink()
+   {
+     _mapped.clear();
+     for (auto it = _valuemap.begin(); it != _valuemap.end(); ++it) _mapped.push_back(&it->second);
+   }
  
    /// Get value of named parameter 
    double ModelParameters::getValue(std::string const & inkey) const
+   {
+     return _values[getIndex(inkey)];
+   }
+
+   /// Get the index of a named parameter
+   size_t ModelParameters::getIndex(std::string const & inkey) const
    {
      assert_contains(inkey);
-     return _values.at(inkey);
+     return _indices.at(inkey);
    }
    
    /// Get values of all parameters
    const std::map<std::string, double>& ModelParameters::getValues() const
    {
-     return _values;
+     return _valuemap;
    }
    
-   /// Get a const iterator to the first parameter map entry
-   std::map<std::string, double>::const_iterator ModelParameters::begin() const
+   /// Get a const iterator to the first parameter
+   ModelParameters::const_iterator ModelParameters::begin() const
    {
-     return getValues().begin();
+     return const_iterator(_indices.begin(), _values.data());
    }
   
-   /// Get a const iterator to the last parameter map entry
-   std::map<std::string, double>::const_iterator ModelParameters::end() const
+   /// Get a const iterator to one past the last parameter
+   ModelParameters::const_iterator ModelParameters::end() const
    {
-     return getValues().end();
+     return const_iterator(_indices.end(), _values.data());
    }
 
    /// Get number of parameters stored in this object
@@ -107,8 +142,7 @@ namespace Gambit
    /// Get parameter value using bracket operator
    const double & ModelParameters::operator[](std::string const & inkey) const
    {
-     assert_contains(inkey);
-     return _values.at(inkey);
+     return _values[getIndex(inkey)];
    }
 
    /// Get parameter value using 'at' operator
@@ -117,22 +151,25 @@ namespace Gambit
    /// but for people who are used to maps it is nice to have.
    const double & ModelParameters::at(std::string const & inkey) const
    {
-     assert_contains(inkey);
-     return _values.at(inkey);
+     return _values[getIndex(inkey)];
    }
 
 
    /// Set single parameter value
    void ModelParameters::setValue(std::string const &inkey,double const&value)
    {
-     assert_contains(inkey);
-     _values[inkey]=value;
+     setValue(getIndex(inkey), value);
    }
   
    /// Set many parameter values using another ModelParameters object
    void ModelParameters::setValues(ModelParameters const& donor, bool missing_is_error)
    {
-     setValues(donor.getValues(), missing_is_error); 
+     for (const_iterator it = donor.begin(); it != donor.end(); ++it)
+     {
+       if (missing_is_error) assert_contains(it->first);
+       auto jt = _indices.find(it->first);
+       if (jt != _indices.end()) setValue(jt->second, it->second);
+     }
    }
 
    /// Set many parameter values using a map
@@ -146,7 +183,8 @@ namespace Gambit
        // iterator->first = key
        // iterator->second = value
        if (missing_is_error) assert_contains(iterator->first);
-       if (_values.count(iterator->first)==1) _values[iterator->first]=iterator->second;
+       auto jt = _indices.find(iterator->first);
+       if (jt != _indices.end()) setValue(jt->second, iterator->second);
      }
    }
 
@@ -154,7 +192,7 @@ namespace Gambit
    std::vector<std::string> ModelParameters::getKeys() const
    {
      std::vector<std::string> parnames;
-     for (std::map<std::string,double>::const_iterator it=_values.begin();it!=_values.end();it++)
+     for (std::map<std::string,size_t>::const_iterator it=_indices.begin();it!=_indices.end();it++)
      {
        parnames.push_back((*it).first);
      }
@@ -165,7 +203,7 @@ namespace Gambit
    void ModelParameters::print() const
    {
      std::cout << "ModelParameters: Printing: "<<std::endl;
-     for (std::map<std::string,double>::const_iterator it=_values.begin();it!=_values.end();it++)
+     for (const_iterator it=begin();it!=end();it++)
      {
        std::cout << "parameter: " << it->first << "; value: "<<it->second<<std::endl ;
      }
@@ -174,7 +212,18 @@ namespace Gambit
    /// Define a parameter with name, value (i.e. add to internal map). Value is initialised to zero
    void ModelParameters::_definePar(const std::string &newkey)
    {
-     _values[newkey]=0.;
+     auto it = _indices.find(newkey);
+     if (it != _indices.end())
+     {
+       setValue(it->second, 0.);
+       return;
+     }
+     // Keep the values in alphabetical order of name, so that indices follow the iteration order.
+     it = _indices.emplace(newkey, 0).first;
+     size_t index = (it == _indices.begin() ? 0 : std::prev(it)->second + 1);
+     _values.insert(_values.begin() + index, 0.);
+     _mapped.insert(_mapped.begin() + index, &_valuemap.emplace(newkey, 0.).first->second);
+     for (; it != _indices.end(); ++it) it->second = index++;
    }
 
    /// Define many new parameters at once via a vector of names
@@ -0,0 +1,191 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Lightweight profiler for recording where
+///  the time goes within likelihood evaluations.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+
+#include "gambit/Utils/profiler.hpp"
+#include "gambit/Utils/util_functions.hpp"
+
+namespace Gambit
+{
+   namespace Utils
+   {
+
+      namespace
+      {
+        /// Escape a string for inclusion in a JSON document
+        std::string json_escape(const std::string& in)
+        {
+          std::ostringstream out;
+          for (char c : in)
+          {
+            if (c == '"' or c == '\\') out << '\\' << c;
+            else if (static_cast<unsigned char>(c) < 0x20) out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int(c) << std::dec;
+            else out << c;
+          }
+          return out.str();
+        }
+      }
+
+      /// Global profiler instance
+      Profiler& profiler()
+      {
+        static Profiler global_profiler;
+        return global_profiler;
+      }
+
+      /// Set up the profiler.  A fraction sample_fraction of points will be recorded.
+      void Profiler::configure(double fraction, int myrank, const std::string& prefix)
+      {
+        sample_fraction = fraction;
+        enabled = (fraction > 0);
+        rank = myrank;
+        output_prefix = prefix;
+        t0 = clock::now();
+        if (not enabled) return;
+
+        // Chrome trace-event format, with one 'complete' event per recorded event.
+        ensure_path_exists(output_prefix);
+        std::ostringstream fname;
+        fname << output_prefix << "profile_rank" << rank << ".trace.json";
+        trace.open(fname.str());
+        trace << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+      }
+
+      /// Start a new point, and decide whether it will be recorded.
+      /// The sampled points are spread evenly, rather than randomly, through the scan.
+      void Profiler::begin_point()
+      {
+        if (not enabled) return;
+        // Tidy up if the previous point was abandoned by an exception.
+        if (recording) end_point();
+        npoints++;
+        recording = (std::floor(npoints*sample_fraction) > std::floor((npoints-1)*sample_fraction));
+        if (recording) begin_event("core", "Likelihood_Container", "main");
+      }
+
+      /// Finish the current point, and append its events to the trace-event file.
+      void Profiler::end_point()
+      {
+        if (not recording) return;
+        end_event();
+        recording = false;
+        std::lock_guard<std::mutex> lock(buffers_mutex);
+        // Discard any events left open by exceptions.
+        for (auto& b : buffers) b->stack.clear();
+        // Write the events out now, so that memory use does not grow with the length of the scan.
+        flush_events();
+        trace.flush();
+      }
+
+      /// Append the closed events of all threads to the trace-event file, and free them.  Needs buffers_mutex.
+      void Profiler::flush_events()
+      {
+        for (auto& b : buffers)
+        {
+          for (const closed_event& e : b->events)
+          {
+            trace << (first_event ? "\n" : ",\n") << "{\"name\":\"" << json_escape(e.name) << "\",\"cat\":\"" << e.category
+                  << "\",\"ph\":\"X\",\"ts\":" << std::fixed << std::setprecision(3) << e.start << ",\"dur\":" << e.duration
+                  << ",\"pid\":" << rank << ",\"tid\":" << b->thread_id << "}";
+            first_event = false;
+          }
+          std::vector<closed_event>().swap(b->events);
+        }
+      }
+
+      /// Time since the profiler was configured [us]
+      double Profiler::now() const
+      {
+        return std::chrono::duration<double, std::micro>(clock::now() - t0).count();
+      }
+
+      /// Get the buffer of the calling thread, creating it if needed
+      Profiler::thread_buffer& Profiler::my_buffer()
+      {
+        thread_local thread_buffer* mine = nullptr;
+        if (mine == nullptr)
+        {
+          std::lock_guard<std::mutex> lock(buffers_mutex);
+          buffers.emplace_back(new thread_buffer);
+          mine = buffers.back().get();
+          mine->thread_id = buffers.size() - 1;
+        }
+        return *mine;
+      }
+
+      /// Open an event called origin::name on the calling thread.
+      void Profiler::begin_event(const char* category, const std::string& origin, const std::string& name)
+      {
+        thread_buffer& b = my_buffer();
+        b.stack.push_back({category, (name.empty() ? origin : origin + "::" + name), now(), 0.0});
+      }
+
+      /// Close the most recently opened event on the calling thread.
+      void Profiler::end_event()
+      {
+        thread_buffer& b = my_buffer();
+        if (b.stack.empty()) return;
+        open_event e = std::move(b.stack.back());
+        b.stack.pop_back();
+        double duration = now() - e.start;
+
+        // Attribute the time not spent in child events to the full stack of open events.
+        std::string stack;
+        for (const open_event& parent : b.stack) stack += parent.name + ";";
+        stack += e.name;
+        b.self_times[stack] += duration - e.child_time;
+        if (not b.stack.empty()) b.stack.back().child_time += duration;
+
+        b.events.push_back({e.category, std::move(e.name), e.start, duration});
+      }
+
+      /// Close the trace-event file and write the collapsed-stack file.  Only the first call does anything.
+      /// This is called at the end of the scan, and by the destructor if the run ends any other way.
+      void Profiler::finalise()
+      {
+        if (not enabled) return;
+        std::lock_guard<std::mutex> lock(buffers_mutex);
+        if (finalised) return;
+        finalised = true;
+        recording = false;
+        std::ostringstream fname;
+        fname << output_prefix << "profile_rank" << rank;
+
+        // Events of a point cut short by the end of the run.
+        flush_events();
+        trace << "\n]}" << std::endl;
+        trace.close();
+
+        // Collapsed stacks, with self time in microseconds, merged over threads.
+        std::map<std::string, double> self_times;
+        for (auto& b : buffers)
+        {
+          for (auto& entry : b->self_times) self_times[entry.first] += entry.second;
+        }
+        std::ofstream folded(fname.str() + ".folded");
+        for (auto& entry : self_times)
+        {
+          long long us = std::llround(entry.second);
+          if (us > 0) folded << entry.first << " " << us << "\n";
+        }
+      }
+
+   }
+}
@@ -0,0 +1,288 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Persistent on-disk cache of functor results,
+///  shared between processes and runs.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#include <cstdio>
+#include <cerrno>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <fcntl.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+
+#include "gambit/Utils/result_cache.hpp"
+#include "gambit/Utils/util_functions.hpp"
+#include "gambit/Logs/logger.hpp"
+
+namespace Gambit
+{
+   namespace Utils
+   {
+
+      namespace
+      {
+        /// Marker at the start of every cache entry (bump the number if the format changes)
+        const std::string entry_magic("GAMBITRC1");
+
+        /// Extension of cache entries
+        const std::string entry_ext(".entry");
+
+        /// File holding the total size of the entries, which is also locked while the cache is modified
+        const std::string size_file(".size");
+
+        /// Temporary files older than this (in seconds) were left behind by processes that died while writing them
+        const time_t stale_tmp_age = 3600;
+      }
+
+      /// 64-bit FNV-1a hash of a string.  Unlike std::hash, this is the same for every build and platform.
+      std::uint64_t fnv1a_hash(const std::string& s, std::uint64_t h)
+      {
+        for (unsigned char c : s)
+        {
+          h ^= c;
+          h *= 1099511628211ULL;
+        }
+        return h;
+      }
+
+      /// Use (and create if needed) the cache in directory path, keeping its total size below max_bytes
+      result_cache::result_cache(const std::string& path, std::uint64_t max_bytes)
+       : dir(path.empty() or path.back() == '/' ? path : path + "/")
+       , max_bytes(max_bytes)
+       , size_fd(-1)
+       , n_hits(0)
+       , n_misses(0)
+       , n_stores(0)
+      {
+        ensure_path_exists(dir);
+        char host[256] = "";
+        gethostname(host, sizeof(host) - 1);
+        std::ostringstream ss;
+        ss << ".tmp." << host << "." << getpid();
+        tmp_suffix = ss.str();
+        // Keep the size file open for as long as the cache is used: closing any descriptor of a file releases
+        // all of this process's locks on it, so it must not be opened and closed again while locked.
+        const std::string fname = dir + size_file;
+        size_fd = open(fname.c_str(), O_RDWR | O_CREAT, 0666);
+        if (size_fd < 0) logger() << LogTags::utils << LogTags::warn << "Could not open " << fname
+                                  << "; the size of the result cache will not be limited." << EOM;
+      }
+
+      /// Close the size file
+      result_cache::~result_cache()
+      {
+        if (size_fd >= 0) close(size_fd);
+      }
+
+      /// Location of the entry for key
+      std::string result_cache::entry_path(const std::string& key) const
+      {
+        std::ostringstream ss;
+        ss << std::hex << std::setw(16) << std::setfill('0') << fnv1a_hash(key);
+        const std::string h = ss.str();
+        // Spread the entries over 256 subdirectories, to keep directory listings short on shared filesystems
+        return dir + h.substr(0,2) + "/" + h + entry_ext;
+      }
+
+      /// Look up the entry for key.  Returns false if there is none.
+      bool result_cache::load(const std::string& key, std::string& data)
+      {
+        const std::string fname = entry_path(key);
+        bool found = false;
+        {
+          std::ifstream in(fname, std::ios::binary);
+          std::string magic(entry_magic.size(), ' ');
+          std::string stored_key;
+          std::uint64_t checksum;
+          if (in and in.read(&magic[0], magic.size()) and magic == entry_magic and
+              cache_serialiser<std::string>::read(in, stored_key) and stored_key == key and
+              cache_serialiser<std::string>::read(in, data) and
+              cache_serialiser<std::uint64_t>::read(in, checksum) and checksum == fnv1a_hash(data))
+          {
+            found = true;
+          }
+        }
+        // Mark the entry as recently used, so that it is among the last to be evicted.
+        if (found) utimes(fname.c_str(), NULL);
+
+        std::lock_guard<std::mutex> lock(mtx);
+        if (found) n_hits++; else n_misses++;
+        return found;
+      }
+
+      /// Save data as the entry for key, replacing any existing entry
+      void result_cache::store(const std::string& key, const std::string& data)
+      {
+        const std::string fname = entry_path(key);
+        std::string tmpname;
+        {
+          std::lock_guard<std::mutex> lock(mtx);
+          tmpname = fname + tmp_suffix + "." + std::to_string(n_stores++);
+        }
+
+        // Write the entry to a temporary file, then move it into place.  Renaming is atomic, so other
+        // processes either see the complete entry or none at all.
+        ensure_path_exists(fname);
+        bool ok;
+        {
+          std::ofstream out(tmpname, std::ios::binary);
+          out.write(entry_magic.data(), entry_magic.size());
+          cache_serialiser<std::string>::write(out, key);
+          cache_serialiser<std::string>::write(out, data);
+          cache_serialiser<std::uint64_t>::write(out, fnv1a_hash(data));
+          ok = bool(out);
+        }
+        if (not ok)
+        {
+          std::remove(tmpname.c_str());
+          logger() << LogTags::utils << LogTags::warn << "Could not save result cache entry " << fname << EOM;
+          return;
+        }
+
+        // Move the entry into place and account for it in the total size, making room first if the limit would
+        // be exceeded.  This is done under a lock shared by all processes, so that the limit holds however
+        // many of them add to the cache at once.  The file lock does not exclude other threads of this process,
+        // so they are excluded by the mutex.
+        std::lock_guard<std::mutex> lock(size_mtx);
+        const bool locked = lock_size_file(true);
+        bool moved = true;
+        if (locked)
+        {
+          struct stat st;
+          std::uint64_t new_size = (stat(tmpname.c_str(), &st) == 0 ? st.st_size : 0);
+          std::uint64_t old_size = (stat(fname.c_str(), &st) == 0 ? st.st_size : 0);
+          std::uint64_t total;
+          if (not read_size(total)) total = scan(NULL);
+          total -= std::min(total, old_size);
+          if (total + new_size > max_bytes) total = evict(new_size);
+          moved = (std::rename(tmpname.c_str(), fname.c_str()) == 0);
+          write_size(moved ? total + new_size : total);
+          lock_size_file(false);
+        }
+        else
+        {
+          moved = (std::rename(tmpname.c_str(), fname.c_str()) == 0);
+        }
+        if (not moved)
+        {
+          std::remove(tmpname.c_str());
+          logger() << LogTags::utils << LogTags::warn << "Could not save result cache entry " << fname << EOM;
+        }
+      }
+
+      /// Take (true) or release (false) the lock on the size file, waiting for other processes to release it
+      bool result_cache::lock_size_file(bool take)
+      {
+        if (size_fd < 0) return false;
+        struct flock fl;
+        fl.l_type = (take ? F_WRLCK : F_UNLCK);
+        fl.l_whence = SEEK_SET;
+        fl.l_start = 0;
+        fl.l_len = 0;
+        while (fcntl(size_fd, F_SETLKW, &fl) == -1)
+        {
+          if (errno != EINTR) return false;
+        }
+        return true;
+      }
+
+      /// Read the total size of the entries from the size file.  Returns false if it has not been written yet.
+      bool result_cache::read_size(std::uint64_t& total)
+      {
+        char buf[32] = "";
+        ssize_t n = pread(size_fd, buf, sizeof(buf) - 1, 0);
+        if (n <= 0) return false;
+        buf[n] = '\0';
+        char* end;
+        total = std::strtoull(buf, &end, 10);
+        return end != buf;
+      }
+
+      /// Write the total size of the entries to the size file
+      void result_cache::write_size(std::uint64_t total)
+      {
+        const std::string s = std::to_string(total);
+        if (pwrite(size_fd, s.data(), s.size(), 0) != ssize_t(s.size()) or ftruncate(size_fd, s.size()) != 0)
+        {
+          logger() << LogTags::utils << LogTags::warn << "Could not update the size of the result cache in " << dir << EOM;
+        }
+      }
+
+      /// Add up the sizes of all entries, optionally listing them, and remove stale temporary files
+      std::uint64_t result_cache::scan(std::vector<cache_entry>* entries)
+      {
+        std::uint64_t total = 0;
+        const time_t now = time(NULL);
+        DIR* top = opendir(dir.c_str());
+        if (top == NULL) return 0;
+        while (struct dirent* sub = readdir(top))
+        {
+          if (sub->d_name[0] == '.') continue;
+          const std::string subdir = dir + sub->d_name + "/";
+          DIR* dp = opendir(subdir.c_str());
+          if (dp == NULL) continue;
+          while (struct dirent* ep = readdir(dp))
+          {
+            if (ep->d_name[0] == '.') continue;
+            const std::string name = subdir + ep->d_name;
+            struct stat st;
+            if (stat(name.c_str(), &st) != 0) continue;
+            if (endsWith(name, entry_ext))
+            {
+              if (entries != NULL) entries->push_back({name, std::uint64_t(st.st_size), st.st_mtime});
+              total += st.st_size;
+            }
+            else if (now - st.st_mtime > stale_tmp_age)
+            {
+              std::remove(name.c_str());
+            }
+          }
+          closedir(dp);
+        }
+        closedir(top);
+        return total;
+      }
+
+      /// Remove the least recently used entries until the cache, plus an entry of size incoming, is comfortably below its size limit.
+      /// Must be called with the size file locked.  Returns the total size of the remaining entries.
+      std::uint64_t result_cache::evict(std::uint64_t incoming)
+      {
+        // The recorded total may have drifted (e.g. if entries were deleted by hand), so recount it from the entries themselves.
+        std::vector<cache_entry> entries;
+        std::uint64_t total = scan(&entries);
+        if (total + incoming <= max_bytes) return total;
+
+        // Remove the least recently used entries until the cache is at 90% of its limit, so that this is not needed again right away.
+        std::sort(entries.begin(), entries.end(), [](const cache_entry& a, const cache_entry& b) { return a.mtime < b.mtime; });
+        const std::uint64_t target = max_bytes/10*9;
+        std::size_t removed = 0;
+        for (auto it = entries.begin(); it != entries.end() and total + incoming > target; ++it, ++removed)
+        {
+          std::remove(it->name.c_str());
+          total -= it->size;
+        }
+        logger() << LogTags::utils << LogTags::info << "Removed " << removed << " least recently used entries from the result cache in "
+                 << dir << "; it now holds " << entries.size() - removed << " entries (" << total << " bytes)." << EOM;
+        return total;
+      }
+
+   }
+}
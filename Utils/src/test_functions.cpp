@@ -0,0 +1,95 @@
+//   GAMBIT: Global and Modular BSM Inference Tool
+//   *********************************************
+///  \file
+///
+///  Definitions of analytic test functions for
+///  optimisation and sampling.
+///
+///  *********************************************
+///
+///  Authors (add name and date if you modify):
+///
+///  \author The GAMBIT Collaboration
+///  \date 2026 Oct
+///
+///  *********************************************
+
+#include <cmath>
+#include <algorithm>
+
+#include "gambit/Utils/test_functions.hpp"
+
+namespace Gambit
+{
+
+  namespace TestFunctions
+  {
+
+    double rosenbrock(const std::vector<double> &x)
+    {
+      double r = 0.;
+      for (size_t i = 0; i + 1 < x.size(); i++)
+      {
+        r += (1. - x[i])*(1. - x[i]) + 100.*(x[i+1] - x[i]*x[i])*(x[i+1] - x[i]*x[i]);
+      }
+      return -r;
+    }
+
+    double himmelblau(const std::vector<double> &x)
+    {
+      return - (x[0]*x[0] + x[1] - 11.)*(x[0]*x[0] + x[1] - 11.)
+             - (x[0] + x[1]*x[1] - 7.)*(x[0] + x[1]*x[1] - 7.);
+    }
+
+    double ackley(const std::vector<double> &x)
+    {
+      double r2 = 0., c = 0.;
+      for (const double &p : x)
+      {
+        r2 += p*p;
+        c += std::cos(2.*M_PI*p);
+      }
+      return 20.*std::exp(-0.2*std::sqrt(r2/x.size())) + std::exp(c/x.size()) - M_E - 20.;
+    }
+
+    double eggbox(const std::vector<double> &x)
+    {
+      double prod = 1.;
+      for (const double &p : x) prod *= std::cos(5.*M_PI*p);
+      return std::pow(2. + prod, 5.);
+    }
+
+    double rastrigin(const std::vector<double> &x)
+    {
+      double r = 10.*x.size();
+      for (const double &p : x) r += p*p - 10.*std::cos(2.*M_PI*p);
+      return -r;
+    }
+
+    double beale(const std::vector<double> &x)
+    {
+      const double y2 = x[1]*x[1];
+      return - (1.5 - x[0] + x[0]*x[1])*(1.5 - x[0] + x[0]*x[1])
+             - (2.25 - x[0] + x[0]*y2)*(2.25 - x[0] + x[0]*y2)
+             - (2.625 - x[0] + x[0]*y2*x[1])*(2.625 - x[0] + x[0]*y2*x[1]);
+    }
+
+    double shells(const std::vector<double> &x)
+    {
+      const double radius = 2., width = 0.1;
+      const double norm = -0.5*std::log(2.*M_PI*width*width);
+      double delta[2];
+      for (int i = 0; i < 2; i++)
+      {
+        const double c = i ? 3.5 : -3.5;
+        double r2 = 0.;
+        for (const double &p : x) r2 += (p - c)*(p - c);
+        delta[i] = norm - (std::sqrt(r2) - radius)*(std::sqrt(r2) - radius)/(2.*width*width);
+      }
+      // log(exp(delta[0]) + exp(delta[1]))
+      return std::max(delta[0], delta[1]) + std::log1p(std::exp(-std::abs(delta[0] - delta[1])));
+    }
+
+  }
+
+}
@@ -180,6 +180,7 @@ namespace Gambit
          str fname = filename.substr(fname_start+1,fname_end);
          defpath = "runs/" + fname + "/";
       }
+      defaultOutputPath = defpath;
       scannerNode["default_output_path"] = Utils::ensure_path_exists(defpath+"/scanner_plugins/");
       logNode    ["default_output_path"] = Utils::ensure_path_exists(defpath+"/logs/");
       printerNode["options"]["default_output_path"] = Utils::ensure_path_exists(defpath+"/samples/");
@@ -187,8 +188,9 @@ namespace Gambit
       // Postprocessor is currently incompatible with 'print_timing_data', so need to pass this option on for checking
       scannerNode["print_timing_data"] = getValueOrDef<bool>(false,"print_timing_data");
 
-      // Pass on minimum recognised lnlike and offset to Scanner
+      // Pass on minimum recognised lnlike (and its alternate value) and offset to Scanner
       scannerNode["model_invalid_for_lnlike_below"] = getValueOrDef<double>(0.9*std::numeric_limits<double>::lowest(), "likelihood", "model_invalid_for_lnlike_below");
+      scannerNode["model_invalid_for_lnlike_below_alt"] = getValueOrDef<double>(0.5*scannerNode["model_invalid_for_lnlike_below"].as<double>(), "likelihood", "model_invalid_for_lnlike_below_alt");
       if (hasKey("likelihood", "lnlike_offset"))
         scannerNode["lnlike_offset"] = getValue<double>("likelihood", "lnlike_offset");
 
@@ -276,6 +278,14 @@ namespace Gambit
       bool master_debug = (keyValuePairNode["debug"]) ? keyValuePairNode["debug"].as<bool>() : false;
       bool logger_debug = (logNode["debug"])          ? logNode["debug"].as<bool>()          : false;
       logger().set_log_debug_messages(master_debug or logger_debug);
+      if (logNode["ignore"])
+      {
+        std::vector<std::string> ignored = logNode["ignore"].as<std::vector<std::string>>();
+        logger().set_ignored_tags(std::set<std::string>(ignored.begin(), ignored.end()));
+      }
+      if (logNode["asynchronous"])    logger().set_asynchronous(logNode["asynchronous"].as<bool>());
+      if (logNode["queue_length"])    logger().set_queue_length(logNode["queue_length"].as<int>());
+      if (logNode["block_when_full"]) logger().set_block_when_full(logNode["block_when_full"].as<bool>());
       logger().initialise(loggerinfo);
 
       // Parse the Parameters node and expand out some shorthand syntax
@@ -299,6 +309,9 @@ namespace Gambit
     YAML::Node Parser::getKeyValuePairNode() const {return keyValuePairNode;}
     /// @}
 
+    /// Getter for the default output path (set in the yaml file, or derived from its name)
+    str Parser::getDefaultOutputPath() const {return defaultOutputPath;}
+
     /// Getters for model/parameter section
     /// @{
     bool Parser::hasModelParameterEntry(std::string model, std::string param, std::string key) const
@@ -85,6 +85,37 @@ if(EXISTS "${PROJECT_SOURCE_DIR}/ScannerBit/")
     target_compile_definitions(Printers PRIVATE SCANNER_STANDALONE)
   endif()
   add_dependencies(standalones ScannerBit_standalone)
+
+  # Microbenchmark of the framework's cost per likelihood call (the functor and Likelihood_Container layers need
+  # Core and the modules)
+  if(EXISTS "${PROJECT_SOURCE_DIR}/Core/")
+    set(ScannerBit_overhead_OBJECTS ${GAMBIT_ALL_COMMON_OBJECTS} ${GAMBIT_BIT_OBJECTS} $<TARGET_OBJECTS:Core>)
+    set(ScannerBit_overhead_XTRA ${gambit_XTRA})
+  else()
+    set(ScannerBit_overhead_OBJECTS ${GAMBIT_BASIC_COMMON_OBJECTS})
+    set(ScannerBit_overhead_XTRA ${ScannerBit_XTRA})
+  endif()
+  add_gambit_executable(ScannerBit_overhead "${ScannerBit_overhead_XTRA}"
+                        SOURCES ${PROJECT_SOURCE_DIR}/ScannerBit/examples/ScannerBit_overhead.cpp
+                                $<TARGET_OBJECTS:ScannerBit>
+                                $<TARGET_OBJECTS:Printers>
+                                ${ScannerBit_overhead_OBJECTS}
+  )
+  if(EXISTS "${PROJECT_SOURCE_DIR}/Core/")
+    if (NOT EXCLUDE_FLEXIBLESUSY)
+      add_dependencies(ScannerBit_overhead flexiblesusy)
+    endif()
+  else()
+    target_compile_definitions(ScannerBit_overhead PRIVATE SCANNER_STANDALONE)
+  endif()
+
+  # Run every scanner on every benchmark objective with fixed settings and seeds (see ScannerBit/scripts/scanner_benchmarks.py)
+  add_custom_target(scanner_benchmarks
+                    COMMAND ${PYTHON_EXECUTABLE} ${PROJECT_SOURCE_DIR}/ScannerBit/scripts/scanner_benchmarks.py
+                            -e $<TARGET_FILE:ScannerBit_standalone> -o ${PROJECT_BINARY_DIR}/scanner_benchmarks.json
+                            -d ${PROJECT_BINARY_DIR}/runs/scanner_benchmarks
+                    WORKING_DIRECTORY ${PROJECT_BINARY_DIR}
+                    DEPENDS ScannerBit_standalone)
 endif()
 
 # Add C++ hdf5 combine tool, if we have HDF5 libraries
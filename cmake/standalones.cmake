@@ -27,3 +27,4 @@ add_standalone(DarkBit_standalone_ScalarSingletDM_Z2 SOURCES DarkBit/examples/Da
 add_standalone(DarkBit_standalone_WIMP SOURCES DarkBit/examples/DarkBit_standalone_WIMP.cpp MODULES DarkBit)
 add_standalone(3bithit SOURCES DecayBit/examples/3bithit.cpp MODULES DecayBit SpecBit PrecisionBit)
 add_standalone(FlavBit_standalone SOURCES FlavBit/examples/FlavBit_standalone_example.cpp MODULES FlavBit)
+add_standalone(ObjectivesBit_standalone SOURCES ObjectivesBit/examples/ObjectivesBit_standalone.cpp MODULES ObjectivesBit)